@@ -0,0 +1,106 @@
+#ifndef REORDERED_ALGORITHMS_HPP
+#define REORDERED_ALGORITHMS_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "../graph/vertex_order.hpp"
+#include "s21_graph_algorithms.h"
+
+namespace s21 {
+
+// GraphAlgorithms on a graph renumbered by the order. Vertices passed in and
+// every vertex, path and matrix handed out use the numbering the graph had
+// before Reorder, so callers never see the permutation. With an empty order the
+// calls go straight through.
+class ReorderedAlgorithms {
+public:
+    explicit ReorderedAlgorithms(const VertexOrder& order)
+        : order_(order)
+        , algorithms_()
+    {
+    }
+
+    ~ReorderedAlgorithms() = default;
+
+    std::vector<int> DepthFirstSearch(Graph& graph, int startVertex) {
+        return Restore(algorithms_.DepthFirstSearch(graph, Current(startVertex)));
+    }
+
+    std::vector<int> BreadthFirstSearch(Graph& graph, int startVertex) {
+        return Restore(algorithms_.BreadthFirstSearch(graph, Current(startVertex)));
+    }
+
+    int GetShortestPathBetweenVertices(Graph& graph, int vertex1, int vertex2, SearchMode mode = Unidirectional) {
+        return algorithms_.GetShortestPathBetweenVertices(graph, Current(vertex1), Current(vertex2), mode);
+    }
+
+    ShortestPathTree GetShortestPathTree(Graph& graph, int vertex) {
+        ShortestPathTree tree = algorithms_.GetShortestPathTree(graph, Current(vertex));
+        return order_.Empty() ? tree : order_.Restore(tree);
+    }
+
+    s21::Matrix<int> GetShortestPathsBetweenAllVertices(Graph& graph, AllPairsMethod method = Automatic) {
+        return order_.Restore(algorithms_.GetShortestPathsBetweenAllVertices(graph, method));
+    }
+
+    // Rows and columns follow sources and targets as given.
+    s21::Matrix<int> GetDistanceTable(Graph& graph, const std::vector<int>& sources, const std::vector<int>& targets) {
+        return algorithms_.GetDistanceTable(graph, Current(sources), Current(targets));
+    }
+
+    // Grows from the vertex numbered 1 after reordering, which matters only when
+    // edges are directed.
+    s21::Matrix<int> GetLeastSpanningTree(Graph& graph) {
+        return order_.Restore(algorithms_.GetLeastSpanningTree(graph));
+    }
+
+    TsmResult SolveTravelingSalesmanProblem(Graph& graph) {
+        return order_.Restore(algorithms_.SolveTravelingSalesmanProblem(graph));
+    }
+
+    // Numbered again in the order of the smallest original vertex of each component.
+    std::vector<int> GetConnectedComponents(Graph& graph) {
+        return RestoreComponents(algorithms_.GetConnectedComponents(graph));
+    }
+
+    std::vector<int> GetStronglyConnectedComponents(Graph& graph, ComponentsMethod method = Tarjan) {
+        return RestoreComponents(algorithms_.GetStronglyConnectedComponents(graph, method));
+    }
+
+private:
+    const VertexOrder& order_;
+    GraphAlgorithms algorithms_;
+
+    inline int Current(int vertex) const noexcept { return order_.Empty() ? vertex : order_.Current(vertex); }
+
+    std::vector<int> Current(const std::vector<int>& vertices) const {
+        std::vector<int> res(vertices);
+        for(auto& it : res) it = Current(it);
+        return res;
+    }
+
+    std::vector<int> Restore(const std::vector<int>& vertices) const {
+        return order_.Empty() ? vertices : order_.Restore(vertices);
+    }
+
+    std::vector<int> RestoreComponents(const std::vector<int>& components) const {
+        if(order_.Empty()) return components;
+        std::vector<int> ids(components.size()), res(components.size());
+        for(size_t i = 0; i < components.size(); ++i) {
+            int original = order_.Original(static_cast<int>(i) + 1);
+            if(original == 0) return components;
+            ids[original - 1] = components[i];
+        }
+        std::unordered_map<int, int> numbers;
+        for(size_t i = 0; i < ids.size(); ++i) {
+            res[i] = numbers.emplace(ids[i], static_cast<int>(numbers.size())).first->second;
+        }
+        return res;
+    }
+
+}; // ReorderedAlgorithms
+
+}; // namespace s21
+
+#endif // REORDERED_ALGORITHMS_HPP
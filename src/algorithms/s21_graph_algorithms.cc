@@ -2,22 +2,40 @@
 
 namespace s21 {
 
-std::vector<int> GraphAlgorithms::DepthFirstSearch(Graph &graph,
+namespace {
+
+template <typename W>
+bool DialWeight(W max_weight) {
+  return max_weight <= DIAL_WEIGHT_LIMIT;
+}
+
+}  // namespace
+
+template <typename W>
+std::vector<int> GraphAlgorithms::DepthFirstSearch(BasicGraph<W> &graph,
                                                    int startVertex) {
-  std::vector<int> result;
+  SearchWorkspace workspace;
+  return DepthFirstSearch(graph, startVertex, workspace);
+}
+
+template <typename W>
+const std::vector<int> &GraphAlgorithms::DepthFirstSearch(
+    BasicGraph<W> &graph, int startVertex, SearchWorkspace &workspace) {
+  workspace.Reset(graph.MatrixSize());
+  std::vector<int> &result = workspace.Result();
   if (CorrectVertex(graph, startVertex)) {
-    std::vector<bool> visited(graph.MatrixSize());
-    s21::Stack<int> st;
-    st.Push(startVertex - 1);
-    visited[startVertex - 1] = true;
-    while (!st.Empty()) {
-      result.push_back(st.Top() + 1);
-      int current = st.Pop();
+    std::vector<size_t> &st = workspace.Frontier();
+    st.push_back(startVertex - 1);
+    workspace.Visit(startVertex - 1);
+    while (!st.empty()) {
+      size_t current = st.back();
+      st.pop_back();
+      result.push_back(current + 1);
 
       for (int i = graph.MatrixSize() - 1; i >= 0; i--) {
-        if (graph(i, current) > 0 && !visited[i]) {
-          visited[i] = true;
-          st.Push(i);
+        if (graph(i, current) > 0 && !workspace.Visited(i)) {
+          workspace.Visit(i);
+          st.push_back(i);
         }
       }
     }
@@ -25,22 +43,30 @@ std::vector<int> GraphAlgorithms::DepthFirstSearch(Graph &graph,
   return result;
 }
 
-std::vector<int> GraphAlgorithms::BreadthFirstSearch(Graph &graph,
+template <typename W>
+std::vector<int> GraphAlgorithms::BreadthFirstSearch(BasicGraph<W> &graph,
                                                      int startVertex) {
-  std::vector<int> result;
+  SearchWorkspace workspace;
+  return BreadthFirstSearch(graph, startVertex, workspace);
+}
+
+template <typename W>
+const std::vector<int> &GraphAlgorithms::BreadthFirstSearch(
+    BasicGraph<W> &graph, int startVertex, SearchWorkspace &workspace) {
+  workspace.Reset(graph.MatrixSize());
+  std::vector<int> &result = workspace.Result();
   if (CorrectVertex(graph, startVertex)) {
-    std::vector<bool> visited(graph.MatrixSize());
-    s21::Queue<int> q;
-    q.Push(startVertex - 1);
-    visited[startVertex - 1] = true;
-    while (!q.Empty()) {
-      result.push_back(q.Front() + 1);
-      int current = q.Pop();
+    std::vector<size_t> &q = workspace.Frontier();
+    q.push_back(startVertex - 1);
+    workspace.Visit(startVertex - 1);
+    for (size_t head = 0; head < q.size(); ++head) {
+      size_t current = q[head];
+      result.push_back(current + 1);
 
       for (size_t i = 0; i < graph.MatrixSize(); ++i) {
-        if (graph(i, current) > 0 && !visited[i]) {
-          visited[i] = true;
-          q.Push(i);
+        if (graph(i, current) > 0 && !workspace.Visited(i)) {
+          workspace.Visit(i);
+          q.push_back(i);
         }
       }
     }
@@ -48,69 +74,135 @@ std::vector<int> GraphAlgorithms::BreadthFirstSearch(Graph &graph,
   return result;
 }
 
-int GraphAlgorithms::GetShortestPathBetweenVertices(Graph &graph, int vertex1,
-                                                    int vertex2) {
+template <typename W>
+int GraphAlgorithms::GetShortestPathBetweenVertices(BasicGraph<W> &graph,
+                                                    int vertex1, int vertex2,
+                                                    SearchMode mode) {
+  if (mode == Bidirectional) {
+    if (!CorrectVertex(graph, vertex1) || !CorrectVertex(graph, vertex2))
+      return 0;
+    int result = BidirectionalDijkstra(graph, vertex1 - 1, vertex2 - 1);
+    return result == INF ? 0 : result;
+  }
+  SearchWorkspace workspace;
+  return GetShortestPathBetweenVertices(graph, vertex1, vertex2, workspace);
+}
+
+template <typename W>
+int GraphAlgorithms::GetShortestPathBetweenVertices(
+    BasicGraph<W> &graph, int vertex1, int vertex2,
+    SearchWorkspace &workspace) {
   int result = 0;
   if (CorrectVertex(graph, vertex1) && CorrectVertex(graph, vertex2)) {
-    --vertex1;
-    --vertex2;
-    size_t matrix_size_ = graph.MatrixSize();
-    std::vector<bool> visited(matrix_size_, false);
-    std::vector<int> distance(matrix_size_, INF);
-    distance[vertex1] = 0;
-    int current = vertex1;
-
-    while (!IsAllVertexVisited(visited)) {
-      for (size_t i = 0; i < matrix_size_; ++i) {
-        if (!visited[i] && graph(current, i) > 0) {
-          int sum = distance[current] + graph(current, i);
-          if (distance[i] == INF || (distance[i] > sum)) {
-            distance[i] = sum;
-          }
-        }
-      }
-      visited[current] = true;
+    size_t target = vertex2 - 1;
+    Dijkstra(graph, vertex1 - 1, workspace,
+             [target](size_t vertex) { return vertex == target; });
+    if (workspace.Distance(target) != INF) result = workspace.Distance(target);
+  }
+  return result;
+}
 
-      for (size_t i = 0; i < visited.size(); ++i) {
-        if (!visited[i]) {
-          current = i;
-          break;
-        }
-      }
+int GraphAlgorithms::GetShortestPathBetweenVertices(
+    Graph &graph, int vertex1, int vertex2, const Landmarks &landmarks) {
+  return landmarks.Query(graph, vertex1, vertex2);
+}
 
-      for (size_t i = 0; i < distance.size(); ++i) {
-        if (!visited[i] &&
-            ((distance[i] < distance[current] && distance[i] != INF) ||
-             distance[current] == INF)) {
-          current = i;
-        }
-      }
-      if (distance[current] == INF) distance[current] = 0;
+int GraphAlgorithms::GetShortestPathBetweenVertices(
+    Graph &graph, int vertex1, int vertex2,
+    const ContractionHierarchy &hierarchy) {
+  if (hierarchy.Size() != graph.MatrixSize()) return 0;
+  return hierarchy.Query(vertex1, vertex2);
+}
+
+template <typename W>
+ShortestPathTree GraphAlgorithms::GetShortestPathTree(BasicGraph<W> &graph,
+                                                      int vertex) {
+  ShortestPathTree tree;
+  if (CorrectVertex(graph, vertex)) {
+    SearchWorkspace workspace;
+    Dijkstra(graph, vertex - 1, workspace, [](size_t) { return false; });
+    tree.source = vertex - 1;
+    tree.distance.resize(graph.MatrixSize());
+    tree.parent.resize(graph.MatrixSize());
+    for (size_t i = 0; i < graph.MatrixSize(); ++i) {
+      tree.distance[i] = workspace.Distance(i);
+      tree.parent[i] = workspace.Parent(i);
     }
+  }
+  return tree;
+}
 
-    result = distance[vertex2];
+ShortestPathTree GraphAlgorithms::GetShortestPathTreeParallel(Graph &graph,
+                                                              int vertex,
+                                                              size_t threads) {
+  ShortestPathTree tree;
+  if (CorrectVertex(graph, vertex)) {
+    s21::DeltaStepping engine(threads);
+    tree = engine.Run(graph, vertex - 1);
   }
-  return result;
+  return tree;
+}
+
+template <typename W>
+s21::Matrix<int> GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+    BasicGraph<W> &graph, AllPairsMethod method) {
+  return AllPairs(graph, method, nullptr);
 }
 
+template <typename W>
 s21::Matrix<int> GraphAlgorithms::GetShortestPathsBetweenAllVertices(
-    Graph &graph) {
-  s21::Matrix<int> distance(graph.Matrix());
+    BasicGraph<W> &graph, NextHopMatrix &next_hop, AllPairsMethod method) {
+  return AllPairs(graph, method, &next_hop);
+}
+
+template <typename W>
+s21::Matrix<int> GraphAlgorithms::AllPairs(BasicGraph<W> &graph,
+                                           AllPairsMethod method,
+                                           NextHopMatrix *next_hop) const {
+  if (next_hop) next_hop->Resize(graph.MatrixSize());
+  if (method == Automatic) {
+    size_t matrix_size = graph.MatrixSize(), edges = 0;
+    for (size_t i = 0; i < matrix_size; ++i) {
+      for (size_t z = 0; z < matrix_size; ++z) edges += graph(i, z) > 0;
+    }
+    method = static_cast<double>(edges) <
+                     SPARSE_DENSITY_THRESHOLD * matrix_size * matrix_size
+                 ? Johnson
+                 : FloydWarshall;
+  }
+  return method == Johnson ? JohnsonAllPairs(graph, next_hop)
+                           : FloydWarshallAllPairs(graph, next_hop);
+}
+
+template <typename W>
+s21::Matrix<int> GraphAlgorithms::FloydWarshallAllPairs(
+    BasicGraph<W> &graph, NextHopMatrix *next_hop) const {
+  size_t matrix_size = graph.MatrixSize();
+  s21::Matrix<int> distance(matrix_size, matrix_size);
 
   for (size_t i = 0; i < distance.Rows(); ++i) {
     for (size_t z = 0; z < distance.Cols(); ++z) {
-      if (distance(i, z) == 0 && i != z) distance(i, z) = INF;
+      distance(i, z) = graph(i, z);
+      if (i == z) {
+        distance(i, z) = 0;
+      } else if (distance(i, z) == 0) {
+        distance(i, z) = INF;
+      } else if (next_hop) {
+        next_hop->Set(i, z, z);
+      }
     }
   }
 
   for (size_t i = 0; i < distance.Rows(); ++i) {
     for (size_t z = 0; z < distance.Rows(); ++z) {
+      if (distance(z, i) == INF) continue;
       for (size_t x = 0; x < distance.Rows(); ++x) {
-        if (distance(z, i) != INF && distance(i, x) != INF) {
-          distance(z, x) == INF
-              ? distance(z, x) = distance(z, i) + distance(i, x)
-              : distance(z, x) =
-                    std::min(distance(z, x), distance(z, i) + distance(i, x));
+        if (distance(i, x) != INF) {
+          int sum = distance(z, i) + distance(i, x);
+          if (distance(z, x) == INF || sum < distance(z, x)) {
+            distance(z, x) = sum;
+            if (next_hop) next_hop->Set(z, x, next_hop->Get(z, i));
+          }
         }
       }
     }
@@ -119,60 +211,179 @@ s21::Matrix<int> GraphAlgorithms::GetShortestPathsBetweenAllVertices(
   return distance;
 }
 
-s21::Matrix<int> GraphAlgorithms::GetLeastSpanningTree(Graph &graph) {
+// Weights are never negative, so Johnson's reweighting is the identity and
+// each row is a plain Dijkstra over the compressed adjacency.
+template <typename W>
+s21::Matrix<int> GraphAlgorithms::JohnsonAllPairs(
+    BasicGraph<W> &graph, NextHopMatrix *next_hop) const {
   size_t matrix_size = graph.MatrixSize();
-  s21::Matrix<int> tree(matrix_size, matrix_size);
-  std::vector<bool> visited(matrix_size, false);
-  visited[0] = true;
-  std::vector<std::pair<int, std::pair<size_t, size_t>>> temp;
-  while (!IsAllVertexVisited(visited)) {
-    for (size_t i = 0; i < visited.size(); ++i) {
-      if (visited[i]) {
-        for (size_t z = 0; z < graph.MatrixSize(); ++z) {
-          if (!visited[z] && i != z && graph(i, z) > 0) {
-            temp.push_back(std::pair<int, std::pair<size_t, size_t>>(
-                graph(i, z), std::pair<size_t, size_t>(i, z)));
+  s21::Matrix<int> distance(matrix_size, matrix_size);
+  s21::AdjacencyList adjacency(graph);
+
+  W max_weight = graph.MaxWeight();
+  auto rows = [&](size_t first, size_t step, auto &queue) {
+    std::vector<bool> settled(matrix_size);
+    std::vector<size_t> hop(matrix_size);
+    for (size_t source = first; source < matrix_size; source += step) {
+      int *row = &distance(source, 0);
+      std::fill(row, row + matrix_size, INF);
+      settled.assign(matrix_size, false);
+      row[source] = 0;
+      queue.Clear();
+      queue.Push(0, source);
+      while (!queue.Empty()) {
+        size_t current = queue.Pop().second;
+        if (settled[current]) continue;
+        settled[current] = true;
+        for (size_t e = adjacency.Begin(current); e < adjacency.End(current);
+             ++e) {
+          size_t next = adjacency.Target(e);
+          int sum = row[current] + adjacency.Weight(e);
+          if (!settled[next] && (row[next] == INF || sum < row[next])) {
+            row[next] = sum;
+            hop[next] = current == source ? next : hop[current];
+            queue.Push(sum, next);
           }
         }
       }
+      if (next_hop) {
+        for (size_t i = 0; i < matrix_size; ++i) {
+          if (i != source && row[i] != INF) next_hop->Set(source, i, hop[i]);
+        }
+      }
     }
+  };
 
-    std::pair<int, std::pair<size_t, size_t>> *edge = &temp[0];
-    for (size_t i = 0; i < temp.size(); ++i) {
-      if (temp[i].first < edge->first) {
-        edge = &temp[i];
+  size_t nthreads = std::max<size_t>(
+      1, std::min<size_t>(matrix_size, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> tasks;
+  for (size_t t = 0; t < nthreads; ++t) {
+    tasks.emplace_back(std::async(std::launch::async, [&, t]() {
+      if (DialWeight(max_weight)) {
+        s21::BucketQueue<size_t> queue(max_weight);
+        rows(t, nthreads, queue);
+      } else {
+        s21::RadixHeap<size_t> queue;
+        rows(t, nthreads, queue);
       }
+    }));
+  }
+  for (auto &it : tasks) it.wait();
+
+  return distance;
+}
+
+template <typename W>
+s21::Matrix<int> GraphAlgorithms::GetDistanceTable(
+    BasicGraph<W> &graph, const std::vector<int> &sources,
+    const std::vector<int> &targets) {
+  size_t matrix_size = graph.MatrixSize();
+  s21::Matrix<int> table(sources.size(), targets.size());
+  for (size_t i = 0; i < table.Size(); ++i) table[i] = INF;
+
+  std::vector<bool> is_target(matrix_size, false);
+  size_t total_targets = 0;
+  for (auto it : targets) {
+    if (CorrectVertex(graph, it) && !is_target[it - 1]) {
+      is_target[it - 1] = true;
+      ++total_targets;
     }
+  }
 
-    size_t y = edge->second.first;
-    size_t x = edge->second.second;
-    int val = edge->first;
-    tree(y, x) = val;
-    tree(x, y) = val;
-    visited[x] = true;
-    temp.clear();
+  size_t nthreads = std::max<size_t>(
+      1, std::min<size_t>(sources.size(), std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> tasks;
+  for (size_t t = 0; t < nthreads; ++t) {
+    tasks.emplace_back(std::async(std::launch::async, [&, t]() {
+      SearchWorkspace workspace;
+      for (size_t i = t; i < sources.size(); i += nthreads) {
+        if (!CorrectVertex(graph, sources[i]) || total_targets == 0) continue;
+        size_t remaining = total_targets;
+        Dijkstra(graph, sources[i] - 1, workspace, [&](size_t vertex) {
+          return is_target[vertex] && --remaining == 0;
+        });
+        for (size_t z = 0; z < targets.size(); ++z) {
+          if (CorrectVertex(graph, targets[z]))
+            table(i, z) = workspace.Distance(targets[z] - 1);
+        }
+      }
+    }));
   }
+  for (auto &it : tasks) it.wait();
 
-  return tree;
+  return table;
+}
+
+template <typename W>
+s21::Matrix<int> GraphAlgorithms::GetLeastSpanningTree(BasicGraph<W> &graph) {
+  SearchWorkspace workspace;
+  return GetLeastSpanningTree(graph, workspace);
+}
+
+template <typename W>
+const s21::Matrix<int> &GraphAlgorithms::GetLeastSpanningTree(
+    BasicGraph<W> &graph, SearchWorkspace &workspace) {
+  W max_weight = graph.MaxWeight();
+  size_t reached = 0;
+  if (DialWeight(max_weight)) {
+    reached = Prim(graph, workspace, workspace.EdgeBuckets(max_weight));
+  } else {
+    reached = Prim(graph, workspace, workspace.EdgeHeap());
+  }
+  if (reached < graph.MatrixSize())
+    throw std::logic_error(
+        "It is impossible to build a spanning tree of a disconnected graph.");
+  return workspace.Tree(graph.MatrixSize(), false);
 }
 
 TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(Graph &graph) {
-  s21::AntColony colony(graph);
-  size_t total_ants = graph.Matrix().Size();
-  int steps_without_improves = 30;
-  TsmResult result, temp;
-  result.distance = INFINITY;
+  return SolveTravelingSalesmanProblem(graph, TsmOptions());
+}
+
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(
+    Graph &graph, const TsmOptions &options) {
+  if (graph.MatrixSize() == 0 || !IsStronglyConnected(graph))
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  size_t exact_limit = options.deadline.count() > 0
+                           ? HELD_KARP_DEADLINE_THRESHOLD
+                           : HELD_KARP_THRESHOLD;
+  if (graph.MatrixSize() <= exact_limit) {
+    TsmResult result = SolveTravelingSalesmanProblemHeldKarp(graph);
+    if (options.on_improvement) options.on_improvement(result);
+    return result;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  s21::AntColony colony(graph, s21::BestTour, CANDIDATE_LIST_SIZE,
+                        s21::MaxMin);
+  size_t total_ants = graph.MatrixSize();
+  size_t iterations = 0, steps_without_improves = 0;
+  TsmResult result = s21::TourConstruction::Build(graph), temp;
+  if (colony.Seed(result) && options.on_improvement)
+    options.on_improvement(result);
 
-  while (steps_without_improves) {
+  while (true) {
     colony.CreateAnts(total_ants);
     colony.ReleaseAnts();
     temp = colony.GetBestPath();
-    if (result.distance == temp.distance) {
-      --steps_without_improves;
+    ++iterations;
+    if (temp.vertices.size() > graph.MatrixSize() &&
+        temp.distance < result.distance) {
+      result = temp;
+      steps_without_improves = 0;
+      if (options.on_improvement) options.on_improvement(result);
     } else {
-      result.distance = temp.distance;
-      result.vertices = temp.vertices;
+      ++steps_without_improves;
     }
+    if (steps_without_improves >= options.stagnation) break;
+    if (options.max_iterations > 0 && iterations >= options.max_iterations)
+      break;
+    if (options.deadline.count() > 0 &&
+        std::chrono::steady_clock::now() - start >= options.deadline)
+      break;
+    if (options.cancel && options.cancel->load()) break;
   }
   if (result.vertices.size() < graph.MatrixSize())
     throw std::logic_error(
@@ -182,4 +393,442 @@ TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(Graph &graph) {
   return result;
 }
 
-};  // namespace s21
\ No newline at end of file
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemHeldKarp(
+    Graph &graph, size_t threads) {
+  if (graph.MatrixSize() > HELD_KARP_MAX_VERTICES)
+    throw std::logic_error(
+        "The graph is too large for the exact traveling salesman solver.");
+  TsmResult result = s21::HeldKarp(threads).Solve(graph);
+  if (result.vertices.empty())
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  return result;
+}
+
+TsmBoundedResult GraphAlgorithms::SolveTravelingSalesmanProblemBranchAndBound(
+    Graph &graph, size_t budget, size_t threads) {
+  if (graph.MatrixSize() == 0 || !IsStronglyConnected(graph))
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  s21::AntColony colony(graph);
+  colony.CreateAnts(graph.MatrixSize());
+  colony.ReleaseAnts();
+  TsmBoundedResult result = s21::BranchAndBound(threads).Solve(
+      graph, std::chrono::milliseconds(budget), colony.GetBestPath());
+  if (result.tour.vertices.empty())
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  return result;
+}
+
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemIslands(
+    Graph &graph, const IslandOptions &islands, const TsmOptions &options) {
+  if (graph.MatrixSize() == 0 || !IsStronglyConnected(graph))
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  TsmResult result = s21::IslandModel(graph, islands).Run(options);
+  if (result.vertices.size() <= graph.MatrixSize())
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  return result;
+}
+
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemApproximate(
+    Graph &graph, ConstructionMethod method) {
+  if (graph.MatrixSize() == 0 || !IsStronglyConnected(graph))
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  TsmResult result = s21::TourConstruction::Build(graph, method);
+  if (result.vertices.empty())
+    throw std::logic_error(
+        "It is impossible to solve the traveling salesman problem given a "
+        "given graph.");
+  return result;
+}
+
+template <typename W>
+std::vector<int> GraphAlgorithms::GetConnectedComponents(BasicGraph<W> &graph,
+                                                         size_t threads) {
+  size_t matrix_size = graph.MatrixSize();
+  std::vector<std::atomic<size_t>> parent(matrix_size);
+  for (size_t i = 0; i < matrix_size; ++i) parent[i].store(i);
+
+  auto find = [&](size_t vertex) {
+    size_t up = parent[vertex].load();
+    while (up != vertex) {
+      size_t next = parent[up].load();
+      parent[vertex].compare_exchange_weak(up, next);
+      vertex = next;
+      up = parent[vertex].load();
+    }
+    return vertex;
+  };
+  auto link = [&](size_t u, size_t v) {
+    while (true) {
+      u = find(u);
+      v = find(v);
+      if (u == v) return;
+      if (u < v) std::swap(u, v);
+      size_t expected = u;
+      if (parent[u].compare_exchange_strong(expected, v)) return;
+    }
+  };
+  auto adjacent = [&](size_t u, size_t v) {
+    return u != v && (graph(u, v) > 0 || graph(v, u) > 0);
+  };
+  size_t nthreads =
+      std::max<size_t>(1, std::min<size_t>(matrix_size, threads));
+  auto parallel = [&](auto body) {
+    std::vector<std::future<void>> tasks;
+    for (size_t t = 0; t < nthreads; ++t) {
+      tasks.emplace_back(std::async(std::launch::async, [&, t]() {
+        for (size_t i = t; i < matrix_size; i += nthreads) body(i);
+      }));
+    }
+    for (auto &it : tasks) it.wait();
+  };
+
+  // Afforest: link a few neighbours of every vertex, then only the vertices
+  // outside the largest sampled component scan the rest of their row.
+  std::vector<size_t> scanned(matrix_size, 0);
+  parallel([&](size_t i) {
+    size_t z = 0;
+    for (size_t found = 0; z < matrix_size && found < AFFOREST_SAMPLE_EDGES;
+         ++z) {
+      if (adjacent(i, z)) {
+        link(i, z);
+        ++found;
+      }
+    }
+    scanned[i] = z;
+  });
+  parallel([&](size_t i) { parent[i].store(find(i)); });
+
+  size_t largest = 0;
+  if (matrix_size > 0) {
+    std::unordered_map<size_t, size_t> counts;
+    size_t step = std::max<size_t>(1, matrix_size / AFFOREST_SAMPLE_SIZE);
+    for (size_t i = 0; i < matrix_size; i += step) ++counts[parent[i].load()];
+    largest = std::max_element(counts.begin(), counts.end(),
+                               [](const auto &a, const auto &b) {
+                                 return a.second < b.second;
+                               })
+                  ->first;
+  }
+  parallel([&](size_t i) {
+    if (find(i) == largest) return;
+    for (size_t z = scanned[i]; z < matrix_size; ++z) {
+      if (adjacent(i, z)) link(i, z);
+    }
+  });
+
+  std::vector<size_t> ids(matrix_size);
+  for (size_t i = 0; i < matrix_size; ++i) ids[i] = find(i);
+  return NumberComponents(ids);
+}
+
+template <typename W>
+std::vector<int> GraphAlgorithms::GetStronglyConnectedComponents(
+    BasicGraph<W> &graph, ComponentsMethod method) {
+  return method == Tarjan ? TarjanComponents(graph)
+                          : ForwardBackwardComponents(graph);
+}
+
+template <typename W>
+bool GraphAlgorithms::IsConnected(BasicGraph<W> &graph) {
+  std::vector<int> components = GetConnectedComponents(graph);
+  return std::all_of(components.begin(), components.end(),
+                     [](int it) { return it == 0; });
+}
+
+template <typename W>
+bool GraphAlgorithms::IsStronglyConnected(BasicGraph<W> &graph) {
+  std::vector<int> components = GetStronglyConnectedComponents(graph);
+  return std::all_of(components.begin(), components.end(),
+                     [](int it) { return it == 0; });
+}
+
+template <typename W, typename Settle>
+void GraphAlgorithms::Dijkstra(BasicGraph<W> &graph, size_t source,
+                               SearchWorkspace &workspace,
+                               Settle settle) const {
+  W max_weight = graph.MaxWeight();
+  if (DialWeight(max_weight)) {
+    Dijkstra(graph, source, workspace, workspace.Buckets(max_weight), settle);
+  } else {
+    Dijkstra(graph, source, workspace, workspace.Radix(), settle);
+  }
+}
+
+template <typename W, typename Queue, typename Settle>
+void GraphAlgorithms::Dijkstra(BasicGraph<W> &graph, size_t source,
+                               SearchWorkspace &workspace, Queue &queue,
+                               Settle settle) const {
+  size_t matrix_size = graph.MatrixSize();
+  workspace.Reset(matrix_size);
+  workspace.Label(source, 0, INF);
+  queue.Push(0, source);
+
+  while (!queue.Empty()) {
+    size_t current = queue.Pop().second;
+    if (workspace.Visited(current)) continue;
+    workspace.Visit(current);
+    if (settle(current)) break;
+
+    int distance = workspace.Distance(current);
+    for (size_t i = 0; i < matrix_size; ++i) {
+      int weight = graph(current, i);
+      if (!workspace.Visited(i) && weight > 0) {
+        int sum = distance + weight;
+        int old = workspace.Distance(i);
+        if (old == INF || old > sum) {
+          workspace.Label(i, sum, current);
+          queue.Push(sum, i);
+        }
+      }
+    }
+  }
+}
+
+template <typename W, typename Queue>
+size_t GraphAlgorithms::Prim(BasicGraph<W> &graph, SearchWorkspace &workspace,
+                             Queue &queue) const {
+  size_t matrix_size = graph.MatrixSize(), reached = 0;
+  workspace.Reset(matrix_size);
+  workspace.Tree(matrix_size);
+  for (size_t vertex = 0; vertex < matrix_size; ++reached) {
+    workspace.Visit(vertex);
+    for (size_t z = 0; z < matrix_size; ++z) {
+      if (!workspace.Visited(z) && graph(vertex, z) > 0) {
+        queue.Push(graph(vertex, z), std::make_pair(vertex, z));
+      }
+    }
+
+    vertex = matrix_size;
+    while (!queue.Empty() && vertex == matrix_size) {
+      std::pair<size_t, std::pair<size_t, size_t>> edge = queue.Pop();
+      size_t y = edge.second.first;
+      size_t x = edge.second.second;
+      if (workspace.Visited(x)) continue;
+      workspace.AddTreeEdge(y, x, edge.first);
+      vertex = x;
+    }
+  }
+  return reached;
+}
+
+template <typename W>
+int GraphAlgorithms::BidirectionalDijkstra(BasicGraph<W> &graph, size_t source,
+                                           size_t target) const {
+  using HeapQueue =
+      std::priority_queue<std::pair<int, size_t>,
+                          std::vector<std::pair<int, size_t>>,
+                          std::greater<std::pair<int, size_t>>>;
+  size_t matrix_size = graph.MatrixSize();
+  std::vector<int> distance[2] = {std::vector<int>(matrix_size, INF),
+                                  std::vector<int>(matrix_size, INF)};
+  std::vector<bool> visited[2] = {std::vector<bool>(matrix_size, false),
+                                  std::vector<bool>(matrix_size, false)};
+  HeapQueue queue[2];
+  distance[0][source] = distance[1][target] = 0;
+  queue[0].push(std::make_pair(0, source));
+  queue[1].push(std::make_pair(0, target));
+  int best = source == target ? 0 : INF;
+
+  while (!queue[0].empty() && !queue[1].empty()) {
+    if (best != INF && queue[0].top().first + queue[1].top().first >= best)
+      break;
+    // The reverse search walks the transposed adjacency, i.e. matrix columns.
+    int side = queue[0].top().first <= queue[1].top().first ? 0 : 1;
+    size_t current = queue[side].top().second;
+    queue[side].pop();
+    if (visited[side][current]) continue;
+    visited[side][current] = true;
+
+    for (size_t i = 0; i < matrix_size; ++i) {
+      int weight = side == 0 ? graph(current, i) : graph(i, current);
+      if (weight <= 0 || visited[side][i]) continue;
+      int sum = distance[side][current] + weight;
+      if (distance[side][i] == INF || sum < distance[side][i]) {
+        distance[side][i] = sum;
+        queue[side].push(std::make_pair(sum, i));
+      }
+      if (distance[1 - side][i] != INF &&
+          (best == INF || sum + distance[1 - side][i] < best)) {
+        best = sum + distance[1 - side][i];
+      }
+    }
+  }
+  return best;
+}
+
+template <typename W>
+std::vector<int> GraphAlgorithms::TarjanComponents(BasicGraph<W> &graph) const {
+  size_t matrix_size = graph.MatrixSize();
+  std::vector<size_t> index(matrix_size, 0), low(matrix_size, 0);
+  std::vector<size_t> ids(matrix_size, matrix_size), stack;
+  std::vector<std::pair<size_t, size_t>> calls;
+  size_t counter = 0;
+
+  auto open = [&](size_t vertex) {
+    index[vertex] = low[vertex] = ++counter;
+    stack.push_back(vertex);
+    calls.push_back(std::make_pair(vertex, 0));
+  };
+  for (size_t source = 0; source < matrix_size; ++source) {
+    if (index[source] != 0) continue;
+    open(source);
+    while (!calls.empty()) {
+      size_t vertex = calls.back().first;
+      size_t &z = calls.back().second;
+      for (; z < matrix_size; ++z) {
+        if (z == vertex || graph(vertex, z) <= 0) continue;
+        if (index[z] == 0) break;
+        if (ids[z] == matrix_size)
+          low[vertex] = std::min(low[vertex], index[z]);
+      }
+      if (z < matrix_size) {
+        open(z++);
+        continue;
+      }
+      calls.pop_back();
+      if (!calls.empty()) {
+        size_t caller = calls.back().first;
+        low[caller] = std::min(low[caller], low[vertex]);
+      }
+      if (low[vertex] == index[vertex]) {
+        size_t member = matrix_size;
+        while (member != vertex) {
+          member = stack.back();
+          stack.pop_back();
+          ids[member] = vertex;
+        }
+      }
+    }
+  }
+  return NumberComponents(ids);
+}
+
+template <typename W>
+std::vector<int> GraphAlgorithms::ForwardBackwardComponents(
+    BasicGraph<W> &graph) const {
+  size_t matrix_size = graph.MatrixSize();
+  std::vector<size_t> partition(matrix_size, 0), ids(matrix_size);
+  std::vector<size_t> pivots;
+  if (matrix_size > 0) pivots.push_back(0);
+  size_t parts = 1;
+
+  // Every pivot splits its partition into its component, the forward and the
+  // backward remainders and the unreached rest, each a new partition.
+  while (!pivots.empty()) {
+    size_t pivot = pivots.back(), part = partition[pivot];
+    pivots.pop_back();
+    std::future<std::vector<size_t>> forward =
+        std::async(std::launch::async, [&]() {
+          return Reach(graph, pivot, partition, part, false);
+        });
+    std::vector<size_t> backward = Reach(graph, pivot, partition, part, true);
+    std::vector<size_t> reached = forward.get();
+
+    std::vector<int> side(matrix_size, 0);
+    for (auto it : reached) side[it] |= 1;
+    for (auto it : backward) side[it] |= 2;
+    size_t base = parts;
+    parts += 3;
+    std::vector<bool> seeded(3, false);
+    for (size_t i = 0; i < matrix_size; ++i) {
+      if (partition[i] != part) continue;
+      if (side[i] == 3) {
+        ids[i] = pivot;
+        partition[i] = SIZE_MAX;
+        continue;
+      }
+      partition[i] = base + side[i];
+      if (!seeded[side[i]]) {
+        seeded[side[i]] = true;
+        pivots.push_back(i);
+      }
+    }
+  }
+  return NumberComponents(ids);
+}
+
+template <typename W>
+std::vector<size_t> GraphAlgorithms::Reach(
+    BasicGraph<W> &graph, size_t source, const std::vector<size_t> &partition,
+    size_t part, bool reverse) const {
+  size_t matrix_size = graph.MatrixSize();
+  std::vector<bool> visited(matrix_size, false);
+  std::vector<size_t> res = {source};
+  visited[source] = true;
+  for (size_t head = 0; head < res.size(); ++head) {
+    size_t current = res[head];
+    for (size_t i = 0; i < matrix_size; ++i) {
+      if (visited[i] || partition[i] != part) continue;
+      if ((reverse ? graph(i, current) : graph(current, i)) > 0) {
+        visited[i] = true;
+        res.push_back(i);
+      }
+    }
+  }
+  return res;
+}
+
+std::vector<int> GraphAlgorithms::NumberComponents(
+    const std::vector<size_t> &ids) {
+  std::unordered_map<size_t, int> numbers;
+  std::vector<int> res(ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto it = numbers.emplace(ids[i], static_cast<int>(numbers.size())).first;
+    res[i] = it->second;
+  }
+  return res;
+}
+
+#define S21_GRAPH_ALGORITHMS_INSTANTIATE(W)                                 \
+  template std::vector<int> GraphAlgorithms::DepthFirstSearch(              \
+      BasicGraph<W> &, int);                                                \
+  template std::vector<int> GraphAlgorithms::BreadthFirstSearch(            \
+      BasicGraph<W> &, int);                                                \
+  template const std::vector<int> &GraphAlgorithms::DepthFirstSearch(       \
+      BasicGraph<W> &, int, SearchWorkspace &);                             \
+  template const std::vector<int> &GraphAlgorithms::BreadthFirstSearch(     \
+      BasicGraph<W> &, int, SearchWorkspace &);                             \
+  template int GraphAlgorithms::GetShortestPathBetweenVertices(             \
+      BasicGraph<W> &, int, int, SearchMode);                               \
+  template int GraphAlgorithms::GetShortestPathBetweenVertices(             \
+      BasicGraph<W> &, int, int, SearchWorkspace &);                        \
+  template ShortestPathTree GraphAlgorithms::GetShortestPathTree(           \
+      BasicGraph<W> &, int);                                                \
+  template s21::Matrix<int>                                                 \
+  GraphAlgorithms::GetShortestPathsBetweenAllVertices(BasicGraph<W> &,      \
+                                                      AllPairsMethod);      \
+  template s21::Matrix<int>                                                 \
+  GraphAlgorithms::GetShortestPathsBetweenAllVertices(                      \
+      BasicGraph<W> &, NextHopMatrix &, AllPairsMethod);                    \
+  template s21::Matrix<int> GraphAlgorithms::GetDistanceTable(              \
+      BasicGraph<W> &, const std::vector<int> &, const std::vector<int> &); \
+  template s21::Matrix<int> GraphAlgorithms::GetLeastSpanningTree(          \
+      BasicGraph<W> &);                                                     \
+  template const s21::Matrix<int> &GraphAlgorithms::GetLeastSpanningTree(   \
+      BasicGraph<W> &, SearchWorkspace &);                                  \
+  template std::vector<int> GraphAlgorithms::GetConnectedComponents(        \
+      BasicGraph<W> &, size_t);                                             \
+  template std::vector<int> GraphAlgorithms::GetStronglyConnectedComponents( \
+      BasicGraph<W> &, ComponentsMethod);                                   \
+  template bool GraphAlgorithms::IsConnected(BasicGraph<W> &);              \
+  template bool GraphAlgorithms::IsStronglyConnected(BasicGraph<W> &);
+
+S21_GRAPH_ALGORITHMS_INSTANTIATE(int)
+S21_GRAPH_ALGORITHMS_INSTANTIATE(uint8_t)
+S21_GRAPH_ALGORITHMS_INSTANTIATE(uint16_t)
+
+#undef S21_GRAPH_ALGORITHMS_INSTANTIATE
+
+};  // namespace s21
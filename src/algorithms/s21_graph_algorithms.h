@@ -2,14 +2,65 @@
 #define S21_GRAPH_ALGORITHMS_H
 
 #include <algorithm>
-
+#include <atomic>
+#include <functional>
+#include <future>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "../graph/adjacency_list.hpp"
 #include "../graph/s21_graph.h"
-#include "../data/stack.hpp"
+#include "../data/binary_heap.hpp"
+#include "../data/bucket_queue.hpp"
 #include "../data/queue.hpp"
+#include "../data/radix_heap.hpp"
+#include "../data/search_workspace.hpp"
+#include "../data/stack.hpp"
+#include "../routing/contraction_hierarchy.hpp"
+#include "../routing/delta_stepping.hpp"
+#include "../routing/landmarks.hpp"
+#include "../routing/next_hop_matrix.hpp"
+#include "../routing/path_tree.hpp"
 #include "../salesman/ant_colony.hpp"
+#include "../salesman/branch_and_bound.hpp"
+#include "../salesman/held_karp.hpp"
+#include "../salesman/island_model.hpp"
+#include "../salesman/tour_construction.hpp"
+#include "../salesman/tsm_options.hpp"
 
 namespace s21 {
 
+#define SPARSE_DENSITY_THRESHOLD 0.1
+#define DIAL_WEIGHT_LIMIT 1024
+#define AFFOREST_SAMPLE_EDGES 2
+#define AFFOREST_SAMPLE_SIZE 1024
+#define HELD_KARP_THRESHOLD 20
+#define HELD_KARP_DEADLINE_THRESHOLD 16
+#define BRANCH_AND_BOUND_BUDGET 1000
+
+enum SearchMode {
+    Unidirectional,
+    Bidirectional
+};
+
+enum AllPairsMethod {
+    Automatic,
+    FloydWarshall,
+    Johnson
+};
+
+enum ComponentsMethod {
+    Tarjan,
+    ForwardBackward
+};
+
+// Searches, shortest paths, spanning trees and components take a graph of int,
+// uint8_t or uint16_t weights and report distances as int like for Graph. A
+// uint32_t weight does not fit an int distance, so uint32_t and float graphs
+// have no algorithms. The routing structures and the salesman solvers work on
+// Graph only.
 class GraphAlgorithms {
 public:
 
@@ -20,27 +71,130 @@ public:
 
     ~GraphAlgorithms() = default;
 
-    std::vector<int> DepthFirstSearch(Graph &graph, int startVertex);
+    template <typename W>
+    std::vector<int> DepthFirstSearch(BasicGraph<W> &graph, int startVertex);
+
+    template <typename W>
+    std::vector<int> BreadthFirstSearch(BasicGraph<W> &graph, int startVertex);
+
+    // Workspace overloads reuse the workspace buffers and return references into
+    // it, valid until the workspace is used again.
+    template <typename W>
+    const std::vector<int> &DepthFirstSearch(BasicGraph<W> &graph, int startVertex, SearchWorkspace &workspace);
+
+    template <typename W>
+    const std::vector<int> &BreadthFirstSearch(BasicGraph<W> &graph, int startVertex, SearchWorkspace &workspace);
+
+    template <typename W>
+    int GetShortestPathBetweenVertices(BasicGraph<W> &graph, int vertex1, int vertex2, SearchMode mode = Unidirectional);
+
+    template <typename W>
+    int GetShortestPathBetweenVertices(BasicGraph<W> &graph, int vertex1, int vertex2, SearchWorkspace &workspace);
+
+    int GetShortestPathBetweenVertices(Graph &graph, int vertex1, int vertex2, const Landmarks &landmarks);
 
-    std::vector<int> BreadthFirstSearch(Graph &graph, int startVertex);
+    int GetShortestPathBetweenVertices(Graph &graph, int vertex1, int vertex2, const ContractionHierarchy &hierarchy);
 
-    int GetShortestPathBetweenVertices(Graph &graph, int vertex1, int vertex2);
+    template <typename W>
+    ShortestPathTree GetShortestPathTree(BasicGraph<W> &graph, int vertex);
 
-    s21::Matrix<int> GetShortestPathsBetweenAllVertices(Graph &graph);
+    ShortestPathTree GetShortestPathTreeParallel(Graph &graph, int vertex, size_t threads = std::thread::hardware_concurrency());
 
-    s21::Matrix<int> GetLeastSpanningTree(Graph &graph);
+    // Automatic picks Johnson when fewer than SPARSE_DENSITY_THRESHOLD of V^2 entries are edges.
+    template <typename W>
+    s21::Matrix<int> GetShortestPathsBetweenAllVertices(BasicGraph<W> &graph, AllPairsMethod method = Automatic);
 
+    // Also fills next_hop, from which NextHopMatrix::Route extracts any shortest route.
+    template <typename W>
+    s21::Matrix<int> GetShortestPathsBetweenAllVertices(BasicGraph<W> &graph, NextHopMatrix &next_hop, AllPairsMethod method = Automatic);
+
+    template <typename W>
+    s21::Matrix<int> GetDistanceTable(BasicGraph<W> &graph, const std::vector<int> &sources, const std::vector<int> &targets);
+
+    // Throws unless every vertex is reachable from vertex 1 along edge directions.
+    template <typename W>
+    s21::Matrix<int> GetLeastSpanningTree(BasicGraph<W> &graph);
+
+    template <typename W>
+    const s21::Matrix<int> &GetLeastSpanningTree(BasicGraph<W> &graph, SearchWorkspace &workspace);
+
+    // Exact for graphs up to HELD_KARP_THRESHOLD vertices, the ant colony above.
     TsmResult SolveTravelingSalesmanProblem(Graph &graph);
 
+    // Under a deadline the exact solver is only used up to HELD_KARP_DEADLINE_THRESHOLD vertices.
+    TsmResult SolveTravelingSalesmanProblem(Graph &graph, const TsmOptions &options);
+
+    // Optimal tour for graphs up to HELD_KARP_MAX_VERTICES vertices.
+    TsmResult SolveTravelingSalesmanProblemHeldKarp(Graph &graph, size_t threads = std::thread::hardware_concurrency());
+
+    // Best tour found within the budget in milliseconds and its proven gap to the optimum.
+    TsmBoundedResult SolveTravelingSalesmanProblemBranchAndBound(Graph &graph, size_t budget = BRANCH_AND_BOUND_BUDGET,
+                                                                 size_t threads = std::thread::hardware_concurrency());
+
+    // Ant colonies on parallel islands exchanging their best tours, the options count migration intervals.
+    TsmResult SolveTravelingSalesmanProblemIslands(Graph &graph, const IslandOptions &islands = IslandOptions(),
+                                                   const TsmOptions &options = TsmOptions());
+
+    // Constructed tour without any search, throws when the heuristic cannot close a tour.
+    TsmResult SolveTravelingSalesmanProblemApproximate(Graph &graph, ConstructionMethod method = AllConstructions);
+
+    // Component of every vertex, numbered from 0 in the order of the smallest vertex
+    // of each component. Edge directions are ignored.
+    template <typename W>
+    std::vector<int> GetConnectedComponents(BasicGraph<W> &graph, size_t threads = std::thread::hardware_concurrency());
+
+    // Same numbering, components are the maximal sets of mutually reachable vertices.
+    template <typename W>
+    std::vector<int> GetStronglyConnectedComponents(BasicGraph<W> &graph, ComponentsMethod method = Tarjan);
+
+    template <typename W>
+    bool IsConnected(BasicGraph<W> &graph);
+
+    template <typename W>
+    bool IsStronglyConnected(BasicGraph<W> &graph);
+
 private:
     const int INF;
 
-    inline bool CorrectVertex(Graph &graph, int vertex) const noexcept { return static_cast<size_t>(vertex) > 0 && static_cast<size_t>(vertex) <= graph.MatrixSize(); }
+    // Settle is called once per settled vertex and stops the search by returning true.
+    // Picks Dial's buckets for weights up to DIAL_WEIGHT_LIMIT and a radix heap otherwise.
+    template <typename W, typename Settle>
+    void Dijkstra(BasicGraph<W> &graph, size_t source, SearchWorkspace &workspace, Settle settle) const;
 
-    bool IsAllVertexVisited(std::vector<bool>& vec) const noexcept {
-        for(auto it : vec) if(!it) return false;
-        return true;
-    }
+    template <typename W, typename Queue, typename Settle>
+    void Dijkstra(BasicGraph<W> &graph, size_t source, SearchWorkspace &workspace, Queue &queue, Settle settle) const;
+
+    // Grows the tree along out-edges from vertex 0, returns the number of vertices it reached.
+    template <typename W, typename Queue>
+    size_t Prim(BasicGraph<W> &graph, SearchWorkspace &workspace, Queue &queue) const;
+
+    template <typename W>
+    s21::Matrix<int> AllPairs(BasicGraph<W> &graph, AllPairsMethod method, NextHopMatrix *next_hop) const;
+
+    template <typename W>
+    s21::Matrix<int> FloydWarshallAllPairs(BasicGraph<W> &graph, NextHopMatrix *next_hop) const;
+
+    template <typename W>
+    s21::Matrix<int> JohnsonAllPairs(BasicGraph<W> &graph, NextHopMatrix *next_hop) const;
+
+    template <typename W>
+    int BidirectionalDijkstra(BasicGraph<W> &graph, size_t source, size_t target) const;
+
+    template <typename W>
+    std::vector<int> TarjanComponents(BasicGraph<W> &graph) const;
+
+    template <typename W>
+    std::vector<int> ForwardBackwardComponents(BasicGraph<W> &graph) const;
+
+    // Vertices of partition part reachable from source inside it.
+    template <typename W>
+    std::vector<size_t> Reach(BasicGraph<W> &graph, size_t source, const std::vector<size_t> &partition, size_t part, bool reverse) const;
+
+    // Renumbers arbitrary component ids in the order of their first vertex.
+    static std::vector<int> NumberComponents(const std::vector<size_t> &ids);
+
+    template <typename W>
+    inline bool CorrectVertex(BasicGraph<W> &graph, int vertex) const noexcept { return static_cast<size_t>(vertex) > 0 && static_cast<size_t>(vertex) <= graph.MatrixSize(); }
 
 }; // GraphAlgorithms
 
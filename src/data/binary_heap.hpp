@@ -0,0 +1,44 @@
+#ifndef BINARY_HEAP_HPP
+#define BINARY_HEAP_HPP
+
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Comparison-based min-heap with the interface of RadixHeap and BucketQueue.
+template <typename T>
+class BinaryHeap {
+public:
+    BinaryHeap() = default;
+
+    ~BinaryHeap() = default;
+
+    inline void Push(size_t key, T val) { heap_.push(std::make_pair(key, val)); }
+
+    std::pair<size_t, T> Pop() {
+        if(Empty()) throw std::out_of_range("Heap is empty.\n");
+        std::pair<size_t, T> res = heap_.top();
+        heap_.pop();
+        return res;
+    }
+
+    inline size_t Size() const noexcept { return heap_.size(); }
+
+    inline bool Empty() const noexcept { return heap_.empty(); }
+
+    void Clear() {
+        while(!heap_.empty()) heap_.pop();
+    }
+
+private:
+    std::priority_queue<std::pair<size_t, T>, std::vector<std::pair<size_t, T>>, std::greater<std::pair<size_t, T>>> heap_;
+
+}; // BinaryHeap
+
+}; // namespace s21
+
+#endif // BINARY_HEAP_HPP
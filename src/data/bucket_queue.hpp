@@ -0,0 +1,62 @@
+#ifndef BUCKET_QUEUE_HPP
+#define BUCKET_QUEUE_HPP
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Dial's bucket queue. Keys stored at the same time must fit into a window of
+// max_key + 1 consecutive values, which holds for Dijkstra and Prim when
+// max_key is the largest edge weight.
+template <typename T>
+class BucketQueue {
+public:
+    explicit BucketQueue(size_t max_key)
+        : buckets_(max_key + 1)
+        , size_(0)
+        , cursor_(0)
+    {
+    }
+
+    ~BucketQueue() = default;
+
+    void Push(size_t key, T val) {
+        if(Empty() || key < cursor_) cursor_ = key;
+        buckets_[key % buckets_.size()].push_back(std::make_pair(key, val));
+        ++size_;
+    }
+
+    std::pair<size_t, T> Pop() {
+        if(Empty()) throw std::out_of_range("Queue is empty.\n");
+        while(buckets_[cursor_ % buckets_.size()].empty()) ++cursor_;
+        std::vector<std::pair<size_t, T>>& bucket = buckets_[cursor_ % buckets_.size()];
+        std::pair<size_t, T> res = bucket.back();
+        bucket.pop_back();
+        --size_;
+        return res;
+    }
+
+    inline size_t Size() const noexcept { return size_; }
+
+    inline bool Empty() const noexcept { return size_ == 0; }
+
+    inline size_t MaxKey() const noexcept { return buckets_.size() - 1; }
+
+    void Clear() {
+        if(size_ > 0) for(auto& it : buckets_) it.clear();
+        size_ = 0;
+        cursor_ = 0;
+    }
+
+private:
+    std::vector<std::vector<std::pair<size_t, T>>> buckets_;
+    size_t size_;
+    size_t cursor_;
+
+}; // BucketQueue
+
+}; // namespace s21
+
+#endif // BUCKET_QUEUE_HPP
@@ -0,0 +1,57 @@
+#ifndef MAPPED_ALLOCATOR_HPP
+#define MAPPED_ALLOCATOR_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace s21 {
+
+// Allocator backed by unlinked temporary files mapped into memory, so a
+// s21::Matrix<T, MappedAllocator<T>> lives in the page cache and can be paged
+// out to disk instead of swap. Files are created in $TMPDIR or /tmp.
+template <typename T>
+class MappedAllocator {
+public:
+    using value_type = T;
+
+    MappedAllocator() noexcept = default;
+
+    template <typename U>
+    MappedAllocator(const MappedAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if(n == 0) return nullptr;
+        const char* dir = std::getenv("TMPDIR");
+        std::string path = std::string(dir ? dir : "/tmp") + "/s21_matrix_XXXXXX";
+        int fd = mkstemp(path.data());
+        if(fd < 0) throw std::bad_alloc();
+        unlink(path.c_str());
+        size_t bytes = n * sizeof(T);
+        void* data = MAP_FAILED;
+        if(ftruncate(fd, static_cast<off_t>(bytes)) == 0)
+            data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if(data == MAP_FAILED) throw std::bad_alloc();
+        return static_cast<T*>(data);
+    }
+
+    void deallocate(T* data, size_t n) noexcept {
+        if(data) munmap(data, n * sizeof(T));
+    }
+
+}; // MappedAllocator
+
+template <typename T, typename U>
+inline bool operator==(const MappedAllocator<T>&, const MappedAllocator<U>&) noexcept { return true; }
+
+template <typename T, typename U>
+inline bool operator!=(const MappedAllocator<T>&, const MappedAllocator<U>&) noexcept { return false; }
+
+}; // namespace s21
+
+#endif // MAPPED_ALLOCATOR_HPP
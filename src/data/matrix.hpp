@@ -344,6 +344,11 @@ public:
         return pos > size_ ? data_[0] : data_[pos];
     }
 
+    const T& operator()(size_t i, size_t z) const {
+        size_t pos = i * cols_val_ + z;
+        return pos > size_ ? data_[0] : data_[pos];
+    }
+
     inline bool operator==(const Matrix& other) const noexcept { return EqMatrix(other); }
 
     inline bool operator!=(const Matrix& other) const noexcept { return !EqMatrix(other); }
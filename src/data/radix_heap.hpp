@@ -0,0 +1,69 @@
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Monotone priority queue for integer keys: a pushed key must not be less than
+// the last popped one. Every element moves between buckets at most 64 times.
+template <typename T>
+class RadixHeap {
+public:
+    RadixHeap()
+        : buckets_(65)
+        , size_(0)
+        , last_(0)
+    {
+    }
+
+    ~RadixHeap() = default;
+
+    void Push(size_t key, T val) {
+        if(key < last_) throw std::invalid_argument("Radix heap keys must not decrease.\n");
+        buckets_[Bucket(key)].push_back(std::make_pair(key, val));
+        ++size_;
+    }
+
+    std::pair<size_t, T> Pop() {
+        if(Empty()) throw std::out_of_range("Heap is empty.\n");
+        if(buckets_[0].empty()) {
+            size_t i = 1;
+            while(buckets_[i].empty()) ++i;
+            last_ = buckets_[i][0].first;
+            for(auto& it : buckets_[i]) last_ = std::min(last_, it.first);
+            for(auto& it : buckets_[i]) buckets_[Bucket(it.first)].push_back(it);
+            buckets_[i].clear();
+        }
+        std::pair<size_t, T> res = buckets_[0].back();
+        buckets_[0].pop_back();
+        --size_;
+        return res;
+    }
+
+    inline size_t Size() const noexcept { return size_; }
+
+    inline bool Empty() const noexcept { return size_ == 0; }
+
+    void Clear() {
+        if(size_ > 0) for(auto& it : buckets_) it.clear();
+        size_ = 0;
+        last_ = 0;
+    }
+
+private:
+    std::vector<std::vector<std::pair<size_t, T>>> buckets_;
+    size_t size_;
+    size_t last_;
+
+    inline size_t Bucket(size_t key) const noexcept {
+        return key == last_ ? 0 : 64 - __builtin_clzll(static_cast<unsigned long long>(key ^ last_));
+    }
+
+}; // RadixHeap
+
+}; // namespace s21
+
+#endif // RADIX_HEAP_HPP
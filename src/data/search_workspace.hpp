@@ -0,0 +1,130 @@
+#ifndef SEARCH_WORKSPACE_HPP
+#define SEARCH_WORKSPACE_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "binary_heap.hpp"
+#include "bucket_queue.hpp"
+#include "matrix.hpp"
+#include "radix_heap.hpp"
+
+namespace s21 {
+
+// Reusable buffers for graph searches. Visited flags and distance labels are
+// stamped with a generation counter, so Reset() is O(1) unless the vertex count
+// changes, and repeated searches on one graph allocate nothing. A workspace
+// must not be shared between threads.
+class SearchWorkspace {
+public:
+    SearchWorkspace()
+        : epoch_(0)
+        , buckets_(0)
+        , edge_buckets_(0)
+        , tree_(0, 0)
+    {
+    }
+
+    ~SearchWorkspace() = default;
+
+    void Reset(size_t size) {
+        if(visited_.size() != size) {
+            visited_.assign(size, 0);
+            labeled_.assign(size, 0);
+            distance_.resize(size);
+            parent_.resize(size);
+            epoch_ = 0;
+        }
+        if(++epoch_ == 0) {
+            std::fill(visited_.begin(), visited_.end(), 0);
+            std::fill(labeled_.begin(), labeled_.end(), 0);
+            epoch_ = 1;
+        }
+        frontier_.clear();
+        result_.clear();
+    }
+
+    inline bool Visited(size_t vertex) const noexcept { return visited_[vertex] == epoch_; }
+
+    inline void Visit(size_t vertex) noexcept { visited_[vertex] = epoch_; }
+
+    // Unreachable vertices report -1 as everywhere in GraphAlgorithms.
+    inline int Distance(size_t vertex) const noexcept { return labeled_[vertex] == epoch_ ? distance_[vertex] : -1; }
+
+    inline int Parent(size_t vertex) const noexcept { return labeled_[vertex] == epoch_ ? parent_[vertex] : -1; }
+
+    inline void Label(size_t vertex, int distance, int parent) noexcept {
+        labeled_[vertex] = epoch_;
+        distance_[vertex] = distance;
+        parent_[vertex] = parent;
+    }
+
+    inline std::vector<size_t>& Frontier() noexcept { return frontier_; }
+
+    inline std::vector<int>& Result() noexcept { return result_; }
+
+    RadixHeap<size_t>& Radix() {
+        radix_.Clear();
+        return radix_;
+    }
+
+    BucketQueue<size_t>& Buckets(size_t max_key) {
+        if(buckets_.MaxKey() != max_key) buckets_ = BucketQueue<size_t>(max_key);
+        buckets_.Clear();
+        return buckets_;
+    }
+
+    BinaryHeap<std::pair<size_t, size_t>>& EdgeHeap() {
+        edge_heap_.Clear();
+        return edge_heap_;
+    }
+
+    BucketQueue<std::pair<size_t, size_t>>& EdgeBuckets(size_t max_key) {
+        if(edge_buckets_.MaxKey() != max_key) edge_buckets_ = BucketQueue<std::pair<size_t, size_t>>(max_key);
+        edge_buckets_.Clear();
+        return edge_buckets_;
+    }
+
+    // Adjacency matrix of a spanning tree. With reset the previous tree is
+    // cleared edge by edge unless the size changes.
+    s21::Matrix<int>& Tree(size_t size, bool reset = true) {
+        if(tree_.Rows() != size || tree_.Cols() != size) {
+            tree_ = s21::Matrix<int>(size, size);
+            tree_edges_.clear();
+        } else if(reset) {
+            for(auto& it : tree_edges_) {
+                tree_(it.first, it.second) = 0;
+                tree_(it.second, it.first) = 0;
+            }
+            tree_edges_.clear();
+        }
+        return tree_;
+    }
+
+    void AddTreeEdge(size_t from, size_t to, int weight) {
+        tree_(from, to) = weight;
+        tree_(to, from) = weight;
+        tree_edges_.push_back(std::make_pair(from, to));
+    }
+
+private:
+    uint32_t epoch_;
+    std::vector<uint32_t> visited_;
+    std::vector<uint32_t> labeled_;
+    std::vector<int> distance_;
+    std::vector<int> parent_;
+    std::vector<size_t> frontier_;
+    std::vector<int> result_;
+    RadixHeap<size_t> radix_;
+    BucketQueue<size_t> buckets_;
+    BinaryHeap<std::pair<size_t, size_t>> edge_heap_;
+    BucketQueue<std::pair<size_t, size_t>> edge_buckets_;
+    s21::Matrix<int> tree_;
+    std::vector<std::pair<size_t, size_t>> tree_edges_;
+
+}; // SearchWorkspace
+
+}; // namespace s21
+
+#endif // SEARCH_WORKSPACE_HPP
@@ -0,0 +1,54 @@
+#ifndef ADJACENCY_LIST_HPP
+#define ADJACENCY_LIST_HPP
+
+#include <vector>
+
+#include "s21_graph.h"
+
+namespace s21 {
+
+// Compressed sparse rows of the graph's non-zero entries, loops excluded.
+// The reversed list holds the incoming edges of every vertex.
+class AdjacencyList {
+public:
+    template <typename W>
+    explicit AdjacencyList(BasicGraph<W>& graph, bool reverse = false)
+        : offsets_(graph.MatrixSize() + 1, 0)
+    {
+        size_t size = graph.MatrixSize();
+        for(size_t i = 0; i < size; ++i) {
+            for(size_t z = 0; z < size; ++z) {
+                int weight = reverse ? graph(z, i) : graph(i, z);
+                if(weight > 0 && i != z) {
+                    targets_.push_back(z);
+                    weights_.push_back(weight);
+                }
+            }
+            offsets_[i + 1] = targets_.size();
+        }
+    }
+
+    ~AdjacencyList() = default;
+
+    inline size_t Size() const noexcept { return offsets_.size() - 1; }
+
+    inline size_t Edges() const noexcept { return targets_.size(); }
+
+    inline size_t Begin(size_t vertex) const noexcept { return offsets_[vertex]; }
+
+    inline size_t End(size_t vertex) const noexcept { return offsets_[vertex + 1]; }
+
+    inline size_t Target(size_t edge) const noexcept { return targets_[edge]; }
+
+    inline int Weight(size_t edge) const noexcept { return weights_[edge]; }
+
+private:
+    std::vector<size_t> offsets_;
+    std::vector<size_t> targets_;
+    std::vector<int> weights_;
+
+}; // AdjacencyList
+
+}; // namespace s21
+
+#endif // ADJACENCY_LIST_HPP
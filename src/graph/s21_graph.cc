@@ -1,37 +1,105 @@
 #include "s21_graph.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 namespace s21 {
 
-Graph::Graph(const Graph& other) : adjacency_matrix_(other.adjacency_matrix_) {}
+namespace {
+
+template <typename W>
+bool Negative(W weight) {
+  if constexpr (std::is_signed<W>::value) return weight < W();
+  return false;
+}
+
+// Non-negative, within the range of W and integral for integer weights.
+template <typename W>
+bool Representable(double value) {
+  if (!(value >= 0.0) ||
+      value > static_cast<double>(std::numeric_limits<W>::max()))
+    return false;
+  return !std::is_integral<W>::value || value == std::floor(value);
+}
+
+}  // namespace
+
+template <typename W>
+BasicGraph<W>::BasicGraph(const BasicGraph& other)
+    : adjacency_matrix_(other.adjacency_matrix_),
+      size_(other.size_),
+      symmetric_(other.symmetric_),
+      version_(other.version_),
+      max_weight_(other.max_weight_),
+      max_weight_known_(other.max_weight_known_) {}
 
-bool Graph::LoadGraphFromFile(std::string filename) {
+template <typename W>
+uint64_t BasicGraph<W>::NextVersion() noexcept {
+  static std::atomic<uint64_t> counter(0);
+  return ++counter;
+}
+
+template <typename W>
+bool BasicGraph<W>::LoadGraphFromFile(std::string filename,
+                                      GraphLayout layout) {
   adjacency_matrix_.Clear();
+  size_ = 0;
+  symmetric_ = false;
+  version_ = NextVersion();
+  max_weight_ = W();
+  max_weight_known_ = true;
   bool openres = false;
   std::ifstream fin;
   fin.open(filename);
   if (fin.is_open()) {
     openres = true;
     std::string str;
-    while (std::getline(fin, str)) {
-      adjacency_matrix_.Capacity() == 0 ? MatrixSettings(str)
-                                        : ParseValues(str);
+    while (openres && std::getline(fin, str)) {
+      if (adjacency_matrix_.Capacity() == 0) {
+        MatrixSettings(str);
+      } else {
+        openres = ParseValues(str);
+      }
     }
+    size_ = adjacency_matrix_.Rows();
   }
   fin.close();
+  if (openres && layout != Full) {
+    bool symmetric = true;
+    for (size_t i = 0; i < size_ && symmetric; ++i) {
+      for (size_t z = i + 1; z < size_ && symmetric; ++z) {
+        symmetric = adjacency_matrix_(i, z) == adjacency_matrix_(z, i);
+      }
+    }
+    if (layout == Symmetric && !symmetric) {
+      openres = false;
+    } else {
+      Pack(symmetric);
+    }
+  }
+  if (!openres) {
+    adjacency_matrix_.Clear();
+    size_ = 0;
+    max_weight_ = W();
+  }
   return openres;
 }
 
-void Graph::ExportGraphToDot(std::string filename) {
+template <typename W>
+void BasicGraph<W>::ExportGraphToDot(std::string filename) {
   if (!Utils::StrFormat(filename, ".dot")) filename += ".dot";
   std::ofstream fout;
   fout.open(filename);
   if (fout.is_open()) {
     fout << "graph dotfile {\n";
-    for (size_t i = 0; i < adjacency_matrix_.Cols(); ++i) {
-      for (size_t z = 0; z < adjacency_matrix_.Rows(); ++z) {
-        if (adjacency_matrix_(i, z) != 0) {
+    for (size_t i = 0; i < size_; ++i) {
+      for (size_t z = 0; z < size_; ++z) {
+        if ((*this)(i, z) != W()) {
           fout << "\t" << i + 1 << " -- " << z + 1;
-          fout << " [label=" << adjacency_matrix_(i, z) << "];\n";
+          fout << " [label=" << (*this)(i, z) << "];\n";
         }
       }
     }
@@ -40,20 +108,116 @@ void Graph::ExportGraphToDot(std::string filename) {
   fout.close();
 }
 
-void Graph::MatrixSettings(std::string str) {
+template <typename W>
+bool BasicGraph<W>::SetEdge(int from, int to, W weight) {
+  if (!CorrectVertex(from) || !CorrectVertex(to) || Negative(weight))
+    return false;
+  At(from - 1, to - 1) = weight;
+  max_weight_ = std::max(max_weight_, weight);
+  version_ = NextVersion();
+  return true;
+}
+
+template <typename W>
+int BasicGraph<W>::AddVertex() {
+  s21::Matrix<W> full = FullMatrix();
+  size_t size = size_;
+  adjacency_matrix_ = s21::Matrix<W>(size + 1, size + 1);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t z = 0; z < size; ++z) adjacency_matrix_(i, z) = full(i, z);
+  }
+  size_ = size + 1;
+  if (symmetric_) Pack(true);
+  version_ = NextVersion();
+  return static_cast<int>(size + 1);
+}
+
+template <typename W>
+bool BasicGraph<W>::Permute(const std::vector<size_t>& order) {
+  if (order.size() != size_) return false;
+  std::vector<bool> seen(size_, false);
+  for (auto it : order) {
+    if (it >= size_ || seen[it]) return false;
+    seen[it] = true;
+  }
+  s21::Matrix<W> matrix(size_, size_);
+  for (size_t i = 0; i < size_; ++i) {
+    for (size_t z = 0; z < size_; ++z) {
+      matrix(i, z) = (*this)(order[i], order[z]);
+    }
+  }
+  adjacency_matrix_ = std::move(matrix);
+  if (symmetric_) Pack(true);
+  version_ = NextVersion();
+  return true;
+}
+
+template <typename W>
+s21::Matrix<W> BasicGraph<W>::FullMatrix() const {
+  if (!symmetric_) return adjacency_matrix_;
+  s21::Matrix<W> res(size_, size_);
+  for (size_t i = 0; i < size_; ++i) {
+    for (size_t z = 0; z < size_; ++z) res(i, z) = (*this)(i, z);
+  }
+  return res;
+}
+
+template <typename W>
+W BasicGraph<W>::MaxWeight() const {
+  if (max_weight_known_) return max_weight_;
+  W res = W();
+  for (size_t i = 0; i < size_; ++i) {
+    for (size_t z = symmetric_ ? i : 0; z < size_; ++z) {
+      res = std::max(res, (*this)(i, z));
+    }
+  }
+  max_weight_ = res;
+  max_weight_known_ = true;
+  return res;
+}
+
+template <typename W>
+void BasicGraph<W>::Pack(bool symmetric) {
+  symmetric_ = false;
+  if (!symmetric) return;
+  s21::Matrix<W> triangle(1, size_ * (size_ + 1) / 2);
+  for (size_t i = 0, indx = 0; i < size_; ++i) {
+    for (size_t z = i; z < size_; ++z) triangle(0, indx++) = At(i, z);
+  }
+  adjacency_matrix_ = std::move(triangle);
+  symmetric_ = true;
+}
+
+template <typename W>
+void BasicGraph<W>::MatrixSettings(std::string str) {
   size_t size = std::atoi(str.c_str());
   adjacency_matrix_.SetColsSize(size);
   adjacency_matrix_.Reserve(size * size);
 }
 
-void Graph::ParseValues(std::string str) {
-  std::vector<int> vec;
+template <typename W>
+bool BasicGraph<W>::ParseValues(std::string str) {
+  std::vector<W> vec;
   char* lex = std::strtok((char*)str.data(), " ");
   while (lex != NULL) {
-    vec.push_back(std::atoi(lex));
+    char* end = NULL;
+    double value = std::strtod(lex, &end);
+    if (end == lex || !Representable<W>(value)) return false;
+    for (; *end != '\0'; ++end) {
+      if (!std::isspace(static_cast<unsigned char>(*end))) return false;
+    }
+    vec.push_back(static_cast<W>(value));
+    max_weight_ = std::max(max_weight_, vec.back());
     lex = std::strtok(NULL, " ");
   }
   adjacency_matrix_.PushVector(vec);
+  return true;
 }
 
-};  // namespace s21
\ No newline at end of file
+template class BasicGraph<int>;
+template class BasicGraph<uint8_t>;
+template class BasicGraph<uint16_t>;
+template class BasicGraph<uint32_t>;
+template class BasicGraph<float>;
+
+};  // namespace s21
@@ -1,44 +1,149 @@
 #ifndef S21_GRAPH_H
 #define S21_GRAPH_H
 
+#include <atomic>
+#include <cstdint>
+
 #include "../data/utils.hpp"
 
 namespace s21 {
 
-class Graph {
+enum GraphLayout {
+    Full,
+    Symmetric,
+    Detect
+};
+
+// Weighted graph over an adjacency matrix of W. The symmetric layout keeps only
+// the upper triangle row by row, so (i, z) and (z, i) always share one cell.
+template <typename W>
+class BasicGraph {
 public:
-    Graph()
+    using Weight = W;
+
+    BasicGraph()
         : adjacency_matrix_(0, 0)
+        , size_(0)
+        , symmetric_(false)
+        , version_(NextVersion())
+        , max_weight_(W())
+        , max_weight_known_(true)
     {
     }
 
-    Graph(const Graph& other);
+    BasicGraph(const BasicGraph& other);
 
-    ~Graph() = default;
+    ~BasicGraph() = default;
 
-    bool LoadGraphFromFile(std::string filename);
+    // Symmetric fails on a file that is not symmetric, Detect picks the layout.
+    // Fails and leaves the graph empty on a negative value, a fraction for an
+    // integer W or a value above the largest W.
+    bool LoadGraphFromFile(std::string filename, GraphLayout layout = Full);
 
     void ExportGraphToDot(std::string filename);
 
-    inline size_t TotalElements() const noexcept { return adjacency_matrix_.Size(); }
-    
-    inline size_t MatrixSize() const noexcept { return adjacency_matrix_.Rows(); }
+    // Vertices are numbered from 1, zero weight means no edge.
+    bool SetEdge(int from, int to, W weight);
+
+    inline bool RemoveEdge(int from, int to) { return SetEdge(from, to, W()); }
+
+    int AddVertex();
+
+    // Moves old vertex order[i] to position i, order holds 0-based indices.
+    bool Permute(const std::vector<size_t>& order);
+
+    inline size_t TotalElements() const noexcept { return size_ * size_; }
+
+    inline size_t MatrixSize() const noexcept { return size_; }
+
+    inline bool IsSymmetric() const noexcept { return symmetric_; }
+
+    inline size_t MemoryUsage() const noexcept { return adjacency_matrix_.Size() * sizeof(W); }
+
+    // Every state of every graph gets a unique stamp, so caches may key on it alone.
+    inline uint64_t Version() const noexcept { return version_; }
+
+    // Raw storage, a single row holding the upper triangle in the symmetric layout.
+    inline const s21::Matrix<W>& Matrix() const noexcept { return adjacency_matrix_; }
+
+    // Scoped write access to single cells, numbered from 0 like operator(). The
+    // graph gets a new version when the writer is created, on every cell access
+    // and when it is destroyed, so nothing computed before a write outlives it.
+    class Writer {
+    public:
+        explicit Writer(BasicGraph& graph)
+            : graph_(graph)
+        {
+            graph_.Touch();
+        }
+
+        Writer(const Writer&) = delete;
+
+        Writer& operator=(const Writer&) = delete;
 
-    inline s21::Matrix<int>& Matrix() { return adjacency_matrix_; }
+        ~Writer() { graph_.Touch(); }
 
-    inline int& operator()(int i, int z) { return adjacency_matrix_(i, z); }
+        inline W& operator()(size_t i, size_t z) {
+            graph_.Touch();
+            return graph_.At(i, z);
+        }
 
-    void Debug() { adjacency_matrix_.Debug(); }
+    private:
+        BasicGraph& graph_;
+
+    }; // Writer
+
+    inline Writer Edit() { return Writer(*this); }
+
+    // Square copy of the adjacency matrix in either layout.
+    s21::Matrix<W> FullMatrix() const;
+
+    // Upper bound of the edge weights, exact unless an edge was lowered since loading.
+    W MaxWeight() const;
+
+    inline W operator()(int i, int z) const {
+        if(!symmetric_) return adjacency_matrix_(i, z);
+        return adjacency_matrix_(0, i <= z ? TriangleIndex(i, z) : TriangleIndex(z, i));
+    }
+
+    void Debug() { FullMatrix().Debug(); }
 
 private:
-    s21::Matrix<int> adjacency_matrix_;
+    s21::Matrix<W> adjacency_matrix_;
+    size_t size_;
+    bool symmetric_;
+    uint64_t version_;
+    // Cached by MaxWeight() until the next Touch().
+    mutable W max_weight_;
+    mutable bool max_weight_known_;
+
+    static uint64_t NextVersion() noexcept;
+
+    inline void Touch() noexcept {
+        version_ = NextVersion();
+        max_weight_known_ = false;
+    }
+
+    inline size_t TriangleIndex(size_t i, size_t z) const noexcept { return i * size_ - i * (i + 1) / 2 + z; }
+
+    inline W& At(size_t i, size_t z) {
+        if(!symmetric_) return adjacency_matrix_(i, z);
+        return adjacency_matrix_(0, i <= z ? TriangleIndex(i, z) : TriangleIndex(z, i));
+    }
+
+    inline bool CorrectVertex(int vertex) const noexcept { return vertex > 0 && static_cast<size_t>(vertex) <= MatrixSize(); }
+
+    void Pack(bool symmetric);
 
     void MatrixSettings(std::string str);
 
-    void ParseValues(std::string str);
+    // False on a value that is not a weight W can hold.
+    bool ParseValues(std::string str);
+
+}; // BasicGraph
 
-}; // Graph
+using Graph = BasicGraph<int>;
 
 }; // namespace s21
 
-#endif // S21_GRAPH_H
\ No newline at end of file
+#endif // S21_GRAPH_H
@@ -0,0 +1,211 @@
+#ifndef VERTEX_ORDER_HPP
+#define VERTEX_ORDER_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "../routing/path_tree.hpp"
+#include "../salesman/tsmresult.hpp"
+#include "s21_graph.h"
+
+namespace s21 {
+
+enum VertexOrdering {
+    CuthillMcKee,
+    BreadthFirst,
+    DegreeSorted
+};
+
+// Renumbers the vertices of a graph so that neighbours get close numbers, which
+// keeps traversals within nearby rows of the matrix. Edges are treated as
+// undirected. Results computed on the reordered graph are mapped back to the
+// original numbering with Restore, ReorderedAlgorithms does both directions.
+class VertexOrder {
+public:
+    VertexOrder() = default;
+
+    ~VertexOrder() = default;
+
+    bool Reorder(Graph& graph, VertexOrdering ordering = CuthillMcKee) {
+        if(!Undo(graph)) return false;
+        std::vector<size_t> order = ordering == DegreeSorted ? DegreeOrder(graph) : SearchOrder(graph, ordering == CuthillMcKee);
+        if(!graph.Permute(order)) return false;
+        original_ = std::move(order);
+        current_.assign(original_.size(), 0);
+        for(size_t i = 0; i < original_.size(); ++i) current_[original_[i]] = i;
+        return true;
+    }
+
+    // Brings the graph back to the numbering it had before Reorder.
+    bool Undo(Graph& graph) {
+        if(original_.empty()) return true;
+        if(original_.size() != graph.MatrixSize() || !graph.Permute(current_)) return false;
+        original_.clear();
+        current_.clear();
+        return true;
+    }
+
+    inline bool Empty() const noexcept { return original_.empty(); }
+
+    // Vertices are numbered from 1, zero marks an incorrect vertex.
+    inline int Original(int vertex) const noexcept { return Correct(vertex) ? static_cast<int>(original_[vertex - 1] + 1) : 0; }
+
+    inline int Current(int vertex) const noexcept { return Correct(vertex) ? static_cast<int>(current_[vertex - 1] + 1) : 0; }
+
+    // Traversal orders and other lists of 1-based vertices.
+    std::vector<int> Restore(const std::vector<int>& vertices) const {
+        std::vector<int> res(vertices);
+        for(auto& it : res) it = Original(it);
+        return res;
+    }
+
+    TsmResult Restore(const TsmResult& result) const {
+        TsmResult res(result);
+        for(auto& it : res.vertices) it = it < original_.size() ? original_[it] : it;
+        return res;
+    }
+
+    ShortestPathTree Restore(const ShortestPathTree& tree) const {
+        size_t size = original_.size();
+        if(tree.distance.size() != size || tree.parent.size() != size) return tree;
+        ShortestPathTree res(tree);
+        res.source = tree.source < size ? original_[tree.source] : tree.source;
+        for(size_t i = 0; i < size; ++i) {
+            res.distance[original_[i]] = tree.distance[i];
+            res.parent[original_[i]] = tree.parent[i] < 0 ? tree.parent[i] : static_cast<int>(original_[tree.parent[i]]);
+        }
+        return res;
+    }
+
+    // Square results such as distance matrices and spanning trees.
+    s21::Matrix<int> Restore(const s21::Matrix<int>& matrix) const {
+        size_t size = original_.size();
+        if(matrix.Rows() != size || matrix.Cols() != size) return matrix;
+        s21::Matrix<int> res(size, size);
+        for(size_t i = 0; i < size; ++i) {
+            for(size_t z = 0; z < size; ++z) res(original_[i], original_[z]) = matrix(i, z);
+        }
+        return res;
+    }
+
+    // Largest distance between the numbers of two adjacent vertices.
+    static size_t Bandwidth(const Graph& graph) {
+        size_t res = 0;
+        for(size_t i = 0; i < graph.MatrixSize(); ++i) {
+            for(size_t z = i + 1; z < graph.MatrixSize(); ++z) {
+                if(graph(i, z) != 0 || graph(z, i) != 0) res = std::max(res, z - i);
+            }
+        }
+        return res;
+    }
+
+private:
+    std::vector<size_t> original_;
+    std::vector<size_t> current_;
+
+    inline bool Correct(int vertex) const noexcept { return vertex > 0 && static_cast<size_t>(vertex) <= original_.size(); }
+
+    static std::vector<std::vector<size_t>> Neighbours(const Graph& graph) {
+        size_t size = graph.MatrixSize();
+        std::vector<std::vector<size_t>> res(size);
+        for(size_t i = 0; i < size; ++i) {
+            for(size_t z = i + 1; z < size; ++z) {
+                if(graph(i, z) != 0 || graph(z, i) != 0) {
+                    res[i].push_back(z);
+                    res[z].push_back(i);
+                }
+            }
+        }
+        return res;
+    }
+
+    static std::vector<size_t> DegreeOrder(const Graph& graph) {
+        std::vector<std::vector<size_t>> neighbours = Neighbours(graph);
+        std::vector<size_t> res(neighbours.size());
+        for(size_t i = 0; i < res.size(); ++i) res[i] = i;
+        std::stable_sort(res.begin(), res.end(), [&](size_t a, size_t b) { return neighbours[a].size() > neighbours[b].size(); });
+        return res;
+    }
+
+    // Breadth-first numbering of every component. Cuthill-McKee starts from a
+    // pseudo-peripheral vertex, visits neighbours by increasing degree and
+    // reverses the result.
+    static std::vector<size_t> SearchOrder(const Graph& graph, bool cuthill_mckee) {
+        std::vector<std::vector<size_t>> neighbours = Neighbours(graph);
+        size_t size = neighbours.size();
+        auto degree = [&](size_t a, size_t b) {
+            return neighbours[a].size() != neighbours[b].size() ? neighbours[a].size() < neighbours[b].size() : a < b;
+        };
+        if(cuthill_mckee) {
+            for(auto& it : neighbours) std::sort(it.begin(), it.end(), degree);
+        }
+
+        std::vector<size_t> res, level(size);
+        std::vector<bool> visited(size, false);
+        res.reserve(size);
+        for(size_t i = 0; i < size; ++i) {
+            if(visited[i]) continue;
+            size_t start = i;
+            if(cuthill_mckee) {
+                std::vector<size_t> component;
+                Levels(neighbours, level, i, component);
+                for(auto it : component) {
+                    if(degree(it, start)) start = it;
+                }
+                start = PeripheralVertex(neighbours, level, start, degree);
+            }
+            Visit(neighbours, visited, level, res, start);
+        }
+        if(cuthill_mckee) std::reverse(res.begin(), res.end());
+        return res;
+    }
+
+    // Appends the component of start in breadth-first order, level receives the depths.
+    static void Visit(const std::vector<std::vector<size_t>>& neighbours, std::vector<bool>& visited, std::vector<size_t>& level, std::vector<size_t>& res, size_t start) {
+        size_t head = res.size();
+        visited[start] = true;
+        level[start] = 1;
+        res.push_back(start);
+        while(head < res.size()) {
+            size_t current = res[head++];
+            for(auto it : neighbours[current]) {
+                if(visited[it]) continue;
+                visited[it] = true;
+                level[it] = level[current] + 1;
+                res.push_back(it);
+            }
+        }
+    }
+
+    static size_t Levels(const std::vector<std::vector<size_t>>& neighbours, std::vector<size_t>& level, size_t start, std::vector<size_t>& component) {
+        std::vector<bool> visited(neighbours.size(), false);
+        component.clear();
+        Visit(neighbours, visited, level, component, start);
+        return level[component.back()];
+    }
+
+    // Moves to a vertex of the last level while the eccentricity keeps growing.
+    template <typename Degree>
+    static size_t PeripheralVertex(const std::vector<std::vector<size_t>>& neighbours, std::vector<size_t>& level, size_t start, Degree degree) {
+        std::vector<size_t> component;
+        size_t depth = Levels(neighbours, level, start, component);
+        while(true) {
+            size_t next = component.back();
+            for(auto it : component) {
+                if(level[it] == depth && degree(it, next)) next = it;
+            }
+            std::vector<size_t> candidate;
+            size_t next_depth = Levels(neighbours, level, next, candidate);
+            if(next_depth <= depth) break;
+            start = next;
+            depth = next_depth;
+            component.swap(candidate);
+        }
+        return start;
+    }
+
+}; // VertexOrder
+
+}; // namespace s21
+
+#endif // VERTEX_ORDER_HPP
@@ -0,0 +1,298 @@
+#ifndef CONTRACTION_HIERARCHY_HPP
+#define CONTRACTION_HIERARCHY_HPP
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <queue>
+#include <thread>
+
+#include "../graph/s21_graph.h"
+
+namespace s21 {
+
+#define CH_WITNESS_SETTLE_LIMIT 500
+
+// Contraction hierarchy over a static graph. Vertices are contracted in order of
+// edge difference, shortcuts keep distances between the remaining vertices, and
+// queries run a bidirectional Dijkstra that only climbs the hierarchy.
+class ContractionHierarchy {
+public:
+    ContractionHierarchy()
+        : shortcuts_(0)
+    {
+    }
+
+    ~ContractionHierarchy() = default;
+
+    void Build(Graph& graph, size_t threads = std::thread::hardware_concurrency()) {
+        size_t size = graph.MatrixSize();
+        Adjacency out(size), in(size);
+        for(size_t i = 0; i < size; ++i) {
+            for(size_t z = 0; z < size; ++z) {
+                if(i != z && graph(i, z) > 0) {
+                    out[i].push_back(Edge{z, graph(i, z)});
+                    in[z].push_back(Edge{i, graph(i, z)});
+                }
+            }
+        }
+        Contract(out, in, std::max<size_t>(threads, 1));
+        Finalize(out);
+    }
+
+    // Vertices are numbered from 1, unreachable targets give 0 as in GraphAlgorithms.
+    int Query(int vertex1, int vertex2, size_t* settled = nullptr) const {
+        size_t size = rank_.size();
+        if(settled) *settled = 0;
+        if(vertex1 <= 0 || vertex2 <= 0 || static_cast<size_t>(vertex1) > size || static_cast<size_t>(vertex2) > size) return 0;
+        std::vector<int> forward(size, INF), backward(size, INF);
+        HeapQueue forward_queue, backward_queue;
+        forward[vertex1 - 1] = 0;
+        backward[vertex2 - 1] = 0;
+        forward_queue.push(std::make_pair(0, vertex1 - 1));
+        backward_queue.push(std::make_pair(0, vertex2 - 1));
+        int best = INF;
+
+        while(!forward_queue.empty() || !backward_queue.empty()) {
+            bool use_forward = backward_queue.empty() || (!forward_queue.empty() && forward_queue.top().first <= backward_queue.top().first);
+            HeapQueue& queue = use_forward ? forward_queue : backward_queue;
+            if(best != INF && queue.top().first >= best) break;
+            std::vector<int>& distance = use_forward ? forward : backward;
+            const std::vector<int>& opposite = use_forward ? backward : forward;
+            const Adjacency& edges = use_forward ? up_ : down_;
+            std::pair<int, size_t> top = queue.top();
+            queue.pop();
+            if(top.first > distance[top.second]) continue;
+            if(settled) ++*settled;
+            if(opposite[top.second] != INF && (best == INF || top.first + opposite[top.second] < best))
+                best = top.first + opposite[top.second];
+            for(auto& it : edges[top.second]) {
+                int sum = top.first + it.weight;
+                if(distance[it.to] == INF || sum < distance[it.to]) {
+                    distance[it.to] = sum;
+                    queue.push(std::make_pair(sum, it.to));
+                }
+            }
+        }
+        return best == INF ? 0 : best;
+    }
+
+    bool Save(std::string filename) const {
+        std::ofstream fout(filename);
+        if(!fout.is_open()) return false;
+        fout << rank_.size() << " " << shortcuts_ << "\n";
+        for(auto it : rank_) fout << it << " ";
+        fout << "\n";
+        for(size_t i = 0; i < up_.size(); ++i) {
+            for(auto& it : up_[i]) fout << i + 1 << " " << it.to + 1 << " " << it.weight << "\n";
+            for(auto& it : down_[i]) fout << it.to + 1 << " " << i + 1 << " " << it.weight << "\n";
+        }
+        return true;
+    }
+
+    // Fails and leaves the hierarchy empty unless the ranks are a permutation of
+    // the vertices and every edge joins two of them.
+    bool Load(std::string filename) {
+        Clear();
+        std::ifstream fin(filename);
+        size_t size = 0, shortcuts = 0;
+        if(!fin.is_open() || !(fin >> size >> shortcuts)) return false;
+        std::vector<size_t> rank(size);
+        std::vector<bool> seen(size, false);
+        for(auto& it : rank) {
+            if(!(fin >> it) || it >= size || seen[it]) return false;
+            seen[it] = true;
+        }
+        Adjacency out(size);
+        size_t from = 0, to = 0;
+        int weight = 0;
+        while(fin >> from >> to >> weight) {
+            if(from == 0 || to == 0 || from > size || to > size) return false;
+            out[from - 1].push_back(Edge{to - 1, weight});
+        }
+        if(!fin.eof()) return false;
+        rank_ = std::move(rank);
+        shortcuts_ = shortcuts;
+        Finalize(out);
+        return true;
+    }
+
+    inline size_t Size() const noexcept { return rank_.size(); }
+
+    inline size_t Shortcuts() const noexcept { return shortcuts_; }
+
+private:
+    struct Edge {
+        size_t to;
+        int weight;
+    };
+
+    struct Shortcut {
+        size_t from;
+        size_t to;
+        int weight;
+    };
+
+    using Adjacency = std::vector<std::vector<Edge>>;
+    using HeapQueue = std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<std::pair<int, size_t>>>;
+
+    struct Workspace {
+        std::vector<int> distance;
+        std::vector<size_t> touched;
+    };
+
+    static constexpr int INF = -1;
+
+    std::vector<size_t> rank_;
+    Adjacency up_;
+    Adjacency down_;
+    size_t shortcuts_;
+
+    void Contract(Adjacency& out, Adjacency& in, size_t threads) {
+        size_t size = out.size();
+        std::vector<bool> contracted(size, false);
+        std::vector<int> deleted(size, 0), priority(size, 0);
+        std::vector<Workspace> workspaces(threads, Workspace{std::vector<int>(size, INF), {}});
+        rank_.assign(size, 0);
+        shortcuts_ = 0;
+
+        size_t chunk = (size + threads - 1) / threads;
+        std::vector<std::future<void>> tasks;
+        for(size_t t = 0; t < threads && t * chunk < size; ++t) {
+            tasks.emplace_back(std::async(std::launch::async, [&, t]() {
+                for(size_t v = t * chunk; v < std::min(size, (t + 1) * chunk); ++v)
+                    priority[v] = Priority(out, in, contracted, deleted, v, workspaces[t]);
+            }));
+        }
+        for(auto& it : tasks) it.wait();
+
+        std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<std::pair<int, size_t>>> order;
+        for(size_t v = 0; v < size; ++v) order.push(std::make_pair(priority[v], v));
+
+        size_t level = 0;
+        std::vector<Shortcut> shortcuts;
+        while(!order.empty()) {
+            std::pair<int, size_t> top = order.top();
+            order.pop();
+            size_t v = top.second;
+            if(contracted[v] || top.first != priority[v]) continue;
+            priority[v] = Priority(out, in, contracted, deleted, v, workspaces[0]);
+            if(!order.empty() && priority[v] > order.top().first) {
+                order.push(std::make_pair(priority[v], v));
+                continue;
+            }
+
+            shortcuts.clear();
+            Simulate(out, in, contracted, v, workspaces[0], &shortcuts);
+            for(auto& it : shortcuts) AddEdge(out, in, it);
+            contracted[v] = true;
+            rank_[v] = level++;
+
+            for(auto& it : out[v]) ++deleted[it.to];
+            for(auto& it : in[v]) ++deleted[it.to];
+            for(auto* edges : {&out[v], &in[v]}) {
+                for(auto& it : *edges) {
+                    if(contracted[it.to]) continue;
+                    priority[it.to] = Priority(out, in, contracted, deleted, it.to, workspaces[0]);
+                    order.push(std::make_pair(priority[it.to], it.to));
+                }
+            }
+        }
+    }
+
+    int Priority(Adjacency& out, Adjacency& in, std::vector<bool>& contracted, std::vector<int>& deleted, size_t v, Workspace& workspace) const {
+        int removed = 0;
+        for(auto& it : out[v]) removed += !contracted[it.to];
+        for(auto& it : in[v]) removed += !contracted[it.to];
+        return static_cast<int>(Simulate(out, in, contracted, v, workspace, nullptr)) - removed + deleted[v];
+    }
+
+    size_t Simulate(Adjacency& out, Adjacency& in, std::vector<bool>& contracted, size_t v, Workspace& workspace, std::vector<Shortcut>* shortcuts) const {
+        size_t count = 0;
+        for(auto& source : in[v]) {
+            if(contracted[source.to]) continue;
+            int limit = INF;
+            for(auto& target : out[v]) {
+                if(!contracted[target.to] && target.to != source.to)
+                    limit = std::max(limit, source.weight + target.weight);
+            }
+            if(limit == INF) continue;
+            WitnessSearch(out, contracted, source.to, v, limit, workspace);
+            for(auto& target : out[v]) {
+                if(contracted[target.to] || target.to == source.to) continue;
+                int weight = source.weight + target.weight;
+                int witness = workspace.distance[target.to];
+                if(witness == INF || witness > weight) {
+                    ++count;
+                    if(shortcuts) shortcuts->push_back(Shortcut{source.to, target.to, weight});
+                }
+            }
+        }
+        return count;
+    }
+
+    void WitnessSearch(Adjacency& out, std::vector<bool>& contracted, size_t source, size_t excluded, int limit, Workspace& workspace) const {
+        for(auto it : workspace.touched) workspace.distance[it] = INF;
+        workspace.touched.clear();
+        HeapQueue queue;
+        workspace.distance[source] = 0;
+        workspace.touched.push_back(source);
+        queue.push(std::make_pair(0, source));
+        size_t settled = 0;
+        while(!queue.empty() && settled < CH_WITNESS_SETTLE_LIMIT) {
+            std::pair<int, size_t> top = queue.top();
+            queue.pop();
+            if(top.first > workspace.distance[top.second]) continue;
+            if(top.first > limit) break;
+            ++settled;
+            for(auto& it : out[top.second]) {
+                if(it.to == excluded || contracted[it.to]) continue;
+                int sum = top.first + it.weight;
+                int& distance = workspace.distance[it.to];
+                if(distance == INF || sum < distance) {
+                    if(distance == INF) workspace.touched.push_back(it.to);
+                    distance = sum;
+                    queue.push(std::make_pair(sum, it.to));
+                }
+            }
+        }
+    }
+
+    void AddEdge(Adjacency& out, Adjacency& in, const Shortcut& shortcut) {
+        for(auto& it : out[shortcut.from]) {
+            if(it.to == shortcut.to) {
+                if(shortcut.weight < it.weight) {
+                    it.weight = shortcut.weight;
+                    for(auto& back : in[shortcut.to]) if(back.to == shortcut.from) back.weight = shortcut.weight;
+                }
+                return;
+            }
+        }
+        out[shortcut.from].push_back(Edge{shortcut.to, shortcut.weight});
+        in[shortcut.to].push_back(Edge{shortcut.from, shortcut.weight});
+        ++shortcuts_;
+    }
+
+    void Clear() {
+        rank_.clear();
+        up_.clear();
+        down_.clear();
+        shortcuts_ = 0;
+    }
+
+    void Finalize(Adjacency& out) {
+        up_.assign(out.size(), {});
+        down_.assign(out.size(), {});
+        for(size_t i = 0; i < out.size(); ++i) {
+            for(auto& it : out[i]) {
+                if(rank_[i] < rank_[it.to]) up_[i].push_back(it);
+                else down_[it.to].push_back(Edge{i, it.weight});
+            }
+        }
+    }
+
+}; // ContractionHierarchy
+
+}; // namespace s21
+
+#endif // CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,194 @@
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include "../graph/s21_graph.h"
+#include "path_tree.hpp"
+
+namespace s21 {
+
+#define DELTA_STEPPING_PARALLEL_MIN 256
+
+// Parallel single-source shortest paths by delta-stepping. Edges not heavier
+// than delta are relaxed repeatedly inside a bucket, heavy edges once when the
+// bucket is settled. Relaxation requests are routed to the thread that owns
+// the target vertex, so distance updates need no locks.
+class DeltaStepping {
+public:
+    explicit DeltaStepping(size_t threads = std::thread::hardware_concurrency(), int delta = 0)
+        : threads_(std::max<size_t>(threads, 1))
+        , requested_delta_(delta)
+        , delta_(delta)
+    {
+    }
+
+    ~DeltaStepping() = default;
+
+    // Source is numbered from 0; the result follows ShortestPathTree conventions.
+    ShortestPathTree Run(Graph& graph, size_t source) {
+        ShortestPathTree tree;
+        size_t size = graph.MatrixSize();
+        tree.source = source;
+        tree.distance.assign(size, INF);
+        tree.parent.assign(size, INF);
+        if(source >= size) return tree;
+        Prepare(graph);
+
+        size_t total = static_cast<size_t>(max_weight_ / delta_) + 2;
+        buckets_.assign(total, {});
+        stamp_.assign(size, 0);
+        round_ = 0;
+        pending_ = 1;
+        tree.distance[source] = 0;
+        buckets_[0].push_back(source);
+
+        std::vector<size_t> frontier, settled;
+        for(size_t current = 0; pending_ > 0; ++current) {
+            std::vector<size_t>& bucket = buckets_[current % total];
+            if(bucket.empty()) continue;
+            settled.clear();
+            while(!bucket.empty()) {
+                pending_ -= bucket.size();
+                frontier.clear();
+                Unique(bucket, tree, current, frontier);
+                bucket.clear();
+                settled.insert(settled.end(), frontier.begin(), frontier.end());
+                Relax(frontier, light_, tree, total);
+            }
+            frontier.clear();
+            Unique(settled, tree, current, frontier);
+            Relax(frontier, heavy_, tree, total);
+        }
+        return tree;
+    }
+
+    inline int Delta() const noexcept { return delta_; }
+
+private:
+    struct Edge {
+        size_t to;
+        int weight;
+    };
+
+    struct Request {
+        size_t vertex;
+        int distance;
+        size_t parent;
+    };
+
+    using Adjacency = std::vector<std::vector<Edge>>;
+
+    static constexpr int INF = -1;
+
+    size_t threads_;
+    int requested_delta_;
+    int delta_;
+    int max_weight_;
+    Adjacency light_;
+    Adjacency heavy_;
+    std::vector<std::vector<size_t>> buckets_;
+    std::vector<size_t> stamp_;
+    size_t round_;
+    size_t pending_;
+    std::vector<std::vector<std::vector<Request>>> requests_;
+    std::vector<std::vector<size_t>> improved_;
+
+    // Splits [0, count) into nthreads ranges of at most one element difference in
+    // size, so Parallel(nthreads, nthreads, ...) hands every thread one owner.
+    template <typename Function>
+    void Parallel(size_t count, size_t nthreads, Function function) {
+        if(nthreads == 1) {
+            function(0, 0, count);
+            return;
+        }
+        size_t chunk = (count + nthreads - 1) / nthreads;
+        std::vector<std::future<void>> tasks;
+        for(size_t t = 0; t < nthreads; ++t) {
+            tasks.emplace_back(std::async(std::launch::async, function, t, std::min(count, t * chunk), std::min(count, (t + 1) * chunk)));
+        }
+        for(auto& it : tasks) it.wait();
+    }
+
+    // Splits edges into light and heavy ones and picks delta as the maximal
+    // weight divided by the average degree, unless delta was given explicitly.
+    void Prepare(Graph& graph) {
+        size_t size = graph.MatrixSize();
+        Adjacency all(size);
+        std::vector<int> max_weight(threads_, 1);
+        std::vector<size_t> edges(threads_, 0);
+        Parallel(size, size < DELTA_STEPPING_PARALLEL_MIN ? 1 : threads_, [&](size_t t, size_t from, size_t to) {
+            for(size_t i = from; i < to; ++i) {
+                for(size_t z = 0; z < size; ++z) {
+                    int weight = graph(i, z);
+                    if(weight <= 0 || i == z) continue;
+                    all[i].push_back(Edge{z, weight});
+                    max_weight[t] = std::max(max_weight[t], weight);
+                    ++edges[t];
+                }
+            }
+        });
+        max_weight_ = *std::max_element(max_weight.begin(), max_weight.end());
+        size_t total_edges = 0;
+        for(auto it : edges) total_edges += it;
+        double degree = std::max(1.0, static_cast<double>(total_edges) / static_cast<double>(std::max<size_t>(size, 1)));
+        delta_ = requested_delta_ > 0 ? requested_delta_ : std::max(1, static_cast<int>(max_weight_ / degree));
+
+        light_.assign(size, {});
+        heavy_.assign(size, {});
+        for(size_t i = 0; i < size; ++i) {
+            for(auto& it : all[i]) (it.weight <= delta_ ? light_ : heavy_)[i].push_back(it);
+        }
+        requests_.assign(threads_, std::vector<std::vector<Request>>(threads_));
+        improved_.assign(threads_, {});
+    }
+
+    // Keeps the vertices that still belong to the bucket, each one once.
+    void Unique(std::vector<size_t>& vertices, ShortestPathTree& tree, size_t bucket, std::vector<size_t>& result) {
+        ++round_;
+        for(auto it : vertices) {
+            if(stamp_[it] == round_ || static_cast<size_t>(tree.distance[it] / delta_) != bucket) continue;
+            stamp_[it] = round_;
+            result.push_back(it);
+        }
+    }
+
+    void Relax(std::vector<size_t>& frontier, Adjacency& edges, ShortestPathTree& tree, size_t total) {
+        size_t nthreads = frontier.size() < DELTA_STEPPING_PARALLEL_MIN ? 1 : threads_;
+        Parallel(frontier.size(), nthreads, [&](size_t t, size_t from, size_t to) {
+            for(auto& it : requests_[t]) it.clear();
+            for(size_t i = from; i < to; ++i) {
+                size_t vertex = frontier[i];
+                for(auto& it : edges[vertex]) {
+                    requests_[t][it.to % nthreads].push_back(Request{it.to, tree.distance[vertex] + it.weight, vertex});
+                }
+            }
+        });
+        Parallel(nthreads, nthreads, [&](size_t, size_t from, size_t to) {
+            for(size_t owner = from; owner < to; ++owner) {
+                improved_[owner].clear();
+                for(size_t t = 0; t < nthreads; ++t) {
+                    for(auto& it : requests_[t][owner]) {
+                        int& distance = tree.distance[it.vertex];
+                        if(distance == INF || it.distance < distance) {
+                            distance = it.distance;
+                            tree.parent[it.vertex] = static_cast<int>(it.parent);
+                            improved_[owner].push_back(it.vertex);
+                        }
+                    }
+                }
+            }
+        });
+        for(size_t owner = 0; owner < nthreads; ++owner) {
+            for(auto it : improved_[owner]) buckets_[(tree.distance[it] / delta_) % total].push_back(it);
+            pending_ += improved_[owner].size();
+        }
+    }
+
+}; // DeltaStepping
+
+}; // namespace s21
+
+#endif // DELTA_STEPPING_HPP
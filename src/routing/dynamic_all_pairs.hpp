@@ -0,0 +1,109 @@
+#ifndef DYNAMIC_ALL_PAIRS_HPP
+#define DYNAMIC_ALL_PAIRS_HPP
+
+#include "../algorithms/s21_graph_algorithms.h"
+
+namespace s21 {
+
+// All-pairs distances kept in sync with edge updates made through this class.
+// Decreases cost O(V^2), increases recompute only the rows whose shortest
+// paths used the old edge. Unreachable pairs hold -1, the diagonal holds 0.
+class DynamicAllPairs {
+public:
+    DynamicAllPairs(Graph& graph)
+        : distance_(0, 0)
+        , version_(0)
+    {
+        Rebuild(graph);
+    }
+
+    ~DynamicAllPairs() = default;
+
+    void Rebuild(Graph& graph) {
+        distance_ = algorithms_.GetShortestPathsBetweenAllVertices(graph);
+        version_ = graph.Version();
+    }
+
+    bool SetEdge(Graph& graph, int from, int to, int weight) {
+        if(version_ != graph.Version()) Rebuild(graph);
+        if(!CorrectVertex(graph, from) || !CorrectVertex(graph, to) || weight < 0) return false;
+        size_t u = from - 1, v = to - 1;
+        int old_weight = graph(u, v);
+        graph.SetEdge(from, to, weight);
+        if(weight != 0 && (old_weight == 0 || weight < old_weight)) {
+            DecreaseEdge(u, v, weight);
+            if(graph.IsSymmetric()) DecreaseEdge(v, u, weight);
+        } else if(weight != old_weight) {
+            IncreaseEdge(graph, u, v, old_weight);
+        }
+        version_ = graph.Version();
+        return true;
+    }
+
+    inline bool RemoveEdge(Graph& graph, int from, int to) { return SetEdge(graph, from, to, 0); }
+
+    int AddVertex(Graph& graph) {
+        if(version_ != graph.Version()) Rebuild(graph);
+        int vertex = graph.AddVertex();
+        size_t size = distance_.Rows();
+        s21::Matrix<int> distance(size + 1, size + 1);
+        for(size_t i = 0; i <= size; ++i) {
+            for(size_t z = 0; z <= size; ++z) {
+                distance(i, z) = i < size && z < size ? distance_(i, z) : (i == z ? 0 : INF);
+            }
+        }
+        distance_ = std::move(distance);
+        version_ = graph.Version();
+        return vertex;
+    }
+
+    inline const s21::Matrix<int>& Distances() const noexcept { return distance_; }
+
+    inline int Distance(int vertex1, int vertex2) const { return distance_(vertex1 - 1, vertex2 - 1); }
+
+private:
+    static constexpr int INF = -1;
+
+    s21::GraphAlgorithms algorithms_;
+    s21::Matrix<int> distance_;
+    uint64_t version_;
+
+    inline bool CorrectVertex(Graph& graph, int vertex) const noexcept {
+        return vertex > 0 && static_cast<size_t>(vertex) <= graph.MatrixSize();
+    }
+
+    void DecreaseEdge(size_t u, size_t v, int weight) {
+        size_t size = distance_.Rows();
+        for(size_t i = 0; i < size; ++i) {
+            if(distance_(i, u) == INF) continue;
+            int base = distance_(i, u) + weight;
+            for(size_t z = 0; z < size; ++z) {
+                if(distance_(v, z) == INF) continue;
+                int sum = base + distance_(v, z);
+                if(distance_(i, z) == INF || sum < distance_(i, z)) distance_(i, z) = sum;
+            }
+        }
+    }
+
+    // In the symmetric layout the edge changed in both directions.
+    void IncreaseEdge(Graph& graph, size_t u, size_t v, int old_weight) {
+        if(u == v) return;
+        std::vector<size_t> affected;
+        for(size_t i = 0; i < distance_.Rows(); ++i) {
+            if(UsesEdge(i, u, v, old_weight) || (graph.IsSymmetric() && UsesEdge(i, v, u, old_weight))) affected.push_back(i);
+        }
+        for(auto it : affected) {
+            ShortestPathTree tree = algorithms_.GetShortestPathTree(graph, it + 1);
+            for(size_t z = 0; z < tree.distance.size(); ++z) distance_(it, z) = tree.distance[z];
+        }
+    }
+
+    inline bool UsesEdge(size_t i, size_t u, size_t v, int weight) const {
+        return distance_(u, v) == weight && distance_(i, u) != INF && distance_(i, v) == distance_(i, u) + weight;
+    }
+
+}; // DynamicAllPairs
+
+}; // namespace s21
+
+#endif // DYNAMIC_ALL_PAIRS_HPP
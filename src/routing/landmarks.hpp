@@ -0,0 +1,285 @@
+#ifndef LANDMARKS_HPP
+#define LANDMARKS_HPP
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+
+#include "../graph/s21_graph.h"
+
+namespace s21 {
+
+enum LandmarkSelection {
+    Farthest,
+    Avoid
+};
+
+// ALT preprocessing: distances from and to k landmarks give lower bounds via the
+// triangle inequality, which drive an A* point-to-point query.
+class Landmarks {
+public:
+    Landmarks()
+        : from_(0, 0)
+        , to_(0, 0)
+    {
+    }
+
+    ~Landmarks() = default;
+
+    void Build(Graph& graph, size_t count, LandmarkSelection selection = Avoid) {
+        size_t size = graph.MatrixSize();
+        count = std::min(count, size);
+        landmarks_.clear();
+        from_ = s21::Matrix<int>(count, size);
+        to_ = s21::Matrix<int>(count, size);
+        symmetric_ = IsSymmetric(graph);
+        size_ = size;
+        version_ = graph.Version();
+        std::mt19937 engine(static_cast<unsigned>(size));
+        std::vector<int> distance;
+
+        while(landmarks_.size() < count) {
+            size_t landmark = selection == Farthest ? SelectFarthest(graph, engine) : SelectAvoid(graph, engine);
+            if(Contains(landmark)) landmark = FirstFreeVertex();
+            size_t indx = landmarks_.size();
+            landmarks_.push_back(landmark);
+            Search(graph, landmark, false, distance);
+            for(size_t i = 0; i < size; ++i) from_(indx, i) = distance[i];
+            if(!symmetric_) Search(graph, landmark, true, distance);
+            for(size_t i = 0; i < size; ++i) to_(indx, i) = distance[i];
+        }
+    }
+
+    // The tables bound distances only in the graph state they were built or loaded
+    // for, without landmarks any state will do.
+    inline bool Matches(const Graph& graph) const noexcept {
+        return landmarks_.empty() || (graph.MatrixSize() == size_ && graph.Version() == version_);
+    }
+
+    // Vertices are numbered from 1, unreachable targets give 0 as in GraphAlgorithms.
+    // Gives 0 as well for a graph the tables do not match.
+    int Query(Graph& graph, int vertex1, int vertex2, size_t* settled = nullptr) const {
+        size_t size = graph.MatrixSize();
+        if(settled) *settled = 0;
+        if(!Matches(graph)) return 0;
+        if(vertex1 <= 0 || vertex2 <= 0 || static_cast<size_t>(vertex1) > size || static_cast<size_t>(vertex2) > size) return 0;
+        size_t source = vertex1 - 1, target = vertex2 - 1;
+        std::vector<int> distance(size, INF);
+        std::vector<bool> visited(size, false);
+        HeapQueue queue;
+        distance[source] = 0;
+        queue.push(std::make_pair(LowerBound(source, target), source));
+
+        while(!queue.empty()) {
+            size_t current = queue.top().second;
+            queue.pop();
+            if(visited[current]) continue;
+            visited[current] = true;
+            if(settled) ++*settled;
+            if(current == target) break;
+            for(size_t i = 0; i < size; ++i) {
+                int weight = graph(current, i);
+                if(weight <= 0 || visited[i]) continue;
+                int sum = distance[current] + weight;
+                if(distance[i] == INF || sum < distance[i]) {
+                    distance[i] = sum;
+                    queue.push(std::make_pair(sum + LowerBound(i, target), i));
+                }
+            }
+        }
+        return distance[target] == INF ? 0 : distance[target];
+    }
+
+    // Lower bound of the distance between two vertices numbered from 0.
+    int LowerBound(size_t vertex, size_t target) const {
+        int bound = 0;
+        for(size_t i = 0; i < landmarks_.size(); ++i) {
+            if(from_(i, vertex) != INF && from_(i, target) != INF)
+                bound = std::max(bound, from_(i, target) - from_(i, vertex));
+            if(to_(i, vertex) != INF && to_(i, target) != INF)
+                bound = std::max(bound, to_(i, vertex) - to_(i, target));
+        }
+        return bound;
+    }
+
+    bool Save(std::string filename) const {
+        std::ofstream fout(filename);
+        if(!fout.is_open()) return false;
+        fout << landmarks_.size() << " " << from_.Cols() << "\n";
+        for(auto it : landmarks_) fout << it + 1 << " ";
+        fout << "\n";
+        for(size_t i = 0; i < landmarks_.size(); ++i) {
+            for(size_t z = 0; z < from_.Cols(); ++z) fout << from_(i, z) << " ";
+            fout << "\n";
+            for(size_t z = 0; z < to_.Cols(); ++z) fout << to_(i, z) << " ";
+            fout << "\n";
+        }
+        return true;
+    }
+
+    // Fails on landmarks outside 1..V or a short file and leaves no landmarks then.
+    bool Load(std::string filename, Graph& graph) {
+        Clear();
+        std::ifstream fin(filename);
+        size_t count = 0, size = 0;
+        if(!fin.is_open() || !(fin >> count >> size) || size != graph.MatrixSize() || count > size) return false;
+        std::vector<size_t> landmarks(count, 0);
+        s21::Matrix<int> from(count, size), to(count, size);
+        for(auto& it : landmarks) {
+            if(!(fin >> it) || it == 0 || it > size) return false;
+            --it;
+        }
+        for(size_t i = 0; i < count; ++i) {
+            for(size_t z = 0; z < size; ++z) fin >> from(i, z);
+            for(size_t z = 0; z < size; ++z) fin >> to(i, z);
+        }
+        if(fin.fail()) return false;
+        landmarks_ = std::move(landmarks);
+        from_ = std::move(from);
+        to_ = std::move(to);
+        symmetric_ = from_ == to_;
+        size_ = size;
+        version_ = graph.Version();
+        return true;
+    }
+
+    inline const std::vector<size_t>& Vertices() const noexcept { return landmarks_; }
+
+    inline size_t Count() const noexcept { return landmarks_.size(); }
+
+private:
+    using HeapQueue = std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<std::pair<int, size_t>>>;
+
+    static constexpr int INF = -1;
+
+    std::vector<size_t> landmarks_;
+    s21::Matrix<int> from_;
+    s21::Matrix<int> to_;
+    bool symmetric_ = false;
+    // Graph state the tables belong to.
+    size_t size_ = 0;
+    uint64_t version_ = 0;
+
+    void Clear() {
+        landmarks_.clear();
+        from_ = s21::Matrix<int>(0, 0);
+        to_ = s21::Matrix<int>(0, 0);
+        symmetric_ = false;
+        size_ = 0;
+        version_ = 0;
+    }
+
+    static void Search(Graph& graph, size_t source, bool reverse, std::vector<int>& distance, std::vector<int>* parent = nullptr) {
+        size_t size = graph.MatrixSize();
+        distance.assign(size, INF);
+        if(parent) parent->assign(size, INF);
+        std::vector<bool> visited(size, false);
+        HeapQueue queue;
+        distance[source] = 0;
+        queue.push(std::make_pair(0, source));
+        while(!queue.empty()) {
+            size_t current = queue.top().second;
+            queue.pop();
+            if(visited[current]) continue;
+            visited[current] = true;
+            for(size_t i = 0; i < size; ++i) {
+                int weight = reverse ? graph(i, current) : graph(current, i);
+                if(weight <= 0 || visited[i]) continue;
+                int sum = distance[current] + weight;
+                if(distance[i] == INF || sum < distance[i]) {
+                    distance[i] = sum;
+                    if(parent) (*parent)[i] = current;
+                    queue.push(std::make_pair(sum, i));
+                }
+            }
+        }
+    }
+
+    bool IsSymmetric(Graph& graph) const {
+        if(graph.IsSymmetric()) return true;
+        for(size_t i = 0; i < graph.MatrixSize(); ++i) {
+            for(size_t z = i + 1; z < graph.MatrixSize(); ++z) {
+                if(graph(i, z) != graph(z, i)) return false;
+            }
+        }
+        return true;
+    }
+
+    bool Contains(size_t vertex) const {
+        return std::find(landmarks_.begin(), landmarks_.end(), vertex) != landmarks_.end();
+    }
+
+    size_t FirstFreeVertex() const {
+        size_t vertex = 0;
+        while(Contains(vertex)) ++vertex;
+        return vertex;
+    }
+
+    // Vertex maximizing the minimal distance to the landmarks chosen so far.
+    size_t SelectFarthest(Graph& graph, std::mt19937& engine) const {
+        size_t size = graph.MatrixSize();
+        std::vector<int> distance;
+        if(landmarks_.empty()) {
+            Search(graph, engine() % size, false, distance);
+            return FarthestVertex(distance);
+        }
+        std::vector<int> nearest(size, INF);
+        for(size_t i = 0; i < landmarks_.size(); ++i) {
+            for(size_t z = 0; z < size; ++z) {
+                if(from_(i, z) != INF && (nearest[z] == INF || from_(i, z) < nearest[z])) nearest[z] = from_(i, z);
+            }
+        }
+        return FarthestVertex(nearest);
+    }
+
+    size_t FarthestVertex(std::vector<int>& distance) const {
+        size_t res = FirstFreeVertex();
+        for(size_t i = 0; i < distance.size(); ++i) {
+            if(!Contains(i) && distance[i] > distance[res]) res = i;
+        }
+        return res;
+    }
+
+    // Goldberg-Werneck avoid heuristic: grow a shortest path tree from a random
+    // root and descend into the subtree with the worst lower bounds that holds
+    // no landmark yet.
+    size_t SelectAvoid(Graph& graph, std::mt19937& engine) const {
+        size_t size = graph.MatrixSize();
+        size_t root = engine() % size;
+        std::vector<int> distance, parent;
+        Search(graph, root, false, distance, &parent);
+
+        std::vector<size_t> order;
+        for(size_t i = 0; i < size; ++i) if(distance[i] != INF) order.push_back(i);
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return distance[lhs] > distance[rhs]; });
+
+        std::vector<long long> weight(size, 0);
+        std::vector<bool> blocked(size, false);
+        for(auto it : order) {
+            if(Contains(it)) blocked[it] = true;
+            weight[it] += distance[it] - LowerBound(root, it);
+            if(parent[it] != INF) {
+                weight[parent[it]] += weight[it];
+                if(blocked[it]) blocked[parent[it]] = true;
+            }
+        }
+        for(size_t i = 0; i < size; ++i) if(blocked[i]) weight[i] = 0;
+
+        size_t current = root;
+        while(true) {
+            size_t next = size;
+            for(size_t i = 0; i < size; ++i) {
+                if(parent[i] == static_cast<int>(current) && weight[i] > 0 && (next == size || weight[i] > weight[next])) next = i;
+            }
+            if(next == size) break;
+            current = next;
+        }
+        return current;
+    }
+
+}; // Landmarks
+
+}; // namespace s21
+
+#endif // LANDMARKS_HPP
@@ -0,0 +1,87 @@
+#ifndef NEXT_HOP_MATRIX_HPP
+#define NEXT_HOP_MATRIX_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace s21 {
+
+// First vertex after i on a shortest path from i to z, stored in the narrowest
+// unsigned type able to hold every vertex index plus the "no path" marker.
+class NextHopMatrix {
+public:
+    static constexpr size_t NONE = SIZE_MAX;
+
+    NextHopMatrix()
+        : size_(0)
+        , width_(1)
+    {
+    }
+
+    ~NextHopMatrix() = default;
+
+    void Resize(size_t size) {
+        size_ = size;
+        width_ = size < UINT8_MAX ? 1 : size < UINT16_MAX ? 2 : 4;
+        data_.assign(size * size * width_, 0xFF);
+    }
+
+    size_t Get(size_t i, size_t z) const {
+        const uint8_t* pos = data_.data() + (i * size_ + z) * width_;
+        if(width_ == 1) return *pos == UINT8_MAX ? NONE : *pos;
+        if(width_ == 2) {
+            uint16_t val;
+            std::memcpy(&val, pos, sizeof(val));
+            return val == UINT16_MAX ? NONE : val;
+        }
+        uint32_t val;
+        std::memcpy(&val, pos, sizeof(val));
+        return val == UINT32_MAX ? NONE : val;
+    }
+
+    void Set(size_t i, size_t z, size_t hop) {
+        uint8_t* pos = data_.data() + (i * size_ + z) * width_;
+        if(width_ == 1) {
+            *pos = hop == NONE ? UINT8_MAX : static_cast<uint8_t>(hop);
+        } else if(width_ == 2) {
+            uint16_t val = hop == NONE ? UINT16_MAX : static_cast<uint16_t>(hop);
+            std::memcpy(pos, &val, sizeof(val));
+        } else {
+            uint32_t val = hop == NONE ? UINT32_MAX : static_cast<uint32_t>(hop);
+            std::memcpy(pos, &val, sizeof(val));
+        }
+    }
+
+    // Vertices are numbered from 1. The route includes both ends and is empty
+    // when there is no path.
+    std::vector<int> Route(int from, int to) const {
+        std::vector<int> route;
+        if(from <= 0 || to <= 0 || static_cast<size_t>(from) > size_ || static_cast<size_t>(to) > size_) return route;
+        size_t current = from - 1, target = to - 1;
+        route.push_back(from);
+        while(current != target && route.size() <= size_) {
+            current = Get(current, target);
+            if(current == NONE) return std::vector<int>();
+            route.push_back(static_cast<int>(current) + 1);
+        }
+        if(current != target) route.clear();
+        return route;
+    }
+
+    inline size_t Size() const noexcept { return size_; }
+
+    inline size_t Width() const noexcept { return width_; }
+
+    inline size_t MemoryUsage() const noexcept { return data_.capacity(); }
+
+private:
+    size_t size_;
+    size_t width_;
+    std::vector<uint8_t> data_;
+
+}; // NextHopMatrix
+
+}; // namespace s21
+
+#endif // NEXT_HOP_MATRIX_HPP
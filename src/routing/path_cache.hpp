@@ -0,0 +1,151 @@
+#ifndef PATH_CACHE_HPP
+#define PATH_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+#include "../algorithms/s21_graph_algorithms.h"
+
+namespace s21 {
+
+#define DEFAULT_CACHE_LIMIT (64 << 20)
+
+// Shortest path results for one graph state, bounded by memory in LRU order.
+// Any change of Graph::Version() drops everything cached for the previous state.
+class ShortestPathCache {
+public:
+    using TreePtr = std::shared_ptr<const ShortestPathTree>;
+    using MatrixPtr = std::shared_ptr<const s21::Matrix<int>>;
+
+    explicit ShortestPathCache(size_t memory_limit = DEFAULT_CACHE_LIMIT)
+        : memory_limit_(memory_limit)
+        , memory_usage_(0)
+        , version_(0)
+        , hits_(0)
+        , misses_(0)
+    {
+    }
+
+    ~ShortestPathCache() = default;
+
+    int GetShortestPathBetweenVertices(Graph& graph, int vertex1, int vertex2) {
+        if(!CorrectVertex(graph, vertex1) || !CorrectVertex(graph, vertex2) || vertex1 == vertex2) return 0;
+        int distance = INF;
+        MatrixPtr matrix = Find<MatrixPtr>(graph, ALL_PAIRS_KEY, false);
+        if(matrix) {
+            distance = (*matrix)(vertex1 - 1, vertex2 - 1);
+        } else {
+            distance = GetShortestPathTree(graph, vertex1)->distance[vertex2 - 1];
+        }
+        return distance == INF ? 0 : distance;
+    }
+
+    TreePtr GetShortestPathTree(Graph& graph, int vertex) {
+        if(!CorrectVertex(graph, vertex)) return std::make_shared<const ShortestPathTree>();
+        TreePtr tree = Find<TreePtr>(graph, vertex - 1, true);
+        if(!tree) {
+            uint64_t version = graph.Version();
+            tree = std::make_shared<const ShortestPathTree>(algorithms_.GetShortestPathTree(graph, vertex));
+            Insert(version, vertex - 1, Entry{vertex - 1, tree, nullptr, tree->MemoryUsage()});
+        }
+        return tree;
+    }
+
+    MatrixPtr GetShortestPathsBetweenAllVertices(Graph& graph) {
+        MatrixPtr matrix = Find<MatrixPtr>(graph, ALL_PAIRS_KEY, true);
+        if(!matrix) {
+            uint64_t version = graph.Version();
+            matrix = std::make_shared<const s21::Matrix<int>>(algorithms_.GetShortestPathsBetweenAllVertices(graph));
+            Insert(version, ALL_PAIRS_KEY, Entry{ALL_PAIRS_KEY, nullptr, matrix, sizeof(*matrix) + matrix->Capacity() * sizeof(int)});
+        }
+        return matrix;
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Reset(0);
+    }
+
+    size_t MemoryUsage() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return memory_usage_;
+    }
+
+    size_t Hits() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+    size_t Misses() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return misses_;
+    }
+
+private:
+    static constexpr int INF = -1;
+    static constexpr int ALL_PAIRS_KEY = -1;
+
+    struct Entry {
+        int key;
+        TreePtr tree;
+        MatrixPtr matrix;
+        size_t bytes;
+    };
+
+    s21::GraphAlgorithms algorithms_;
+    size_t memory_limit_;
+    size_t memory_usage_;
+    uint64_t version_;
+    size_t hits_;
+    size_t misses_;
+    std::list<Entry> entries_;
+    std::unordered_map<int, std::list<Entry>::iterator> index_;
+    mutable std::mutex mutex_;
+
+    inline bool CorrectVertex(Graph& graph, int vertex) const noexcept {
+        return vertex > 0 && static_cast<size_t>(vertex) <= graph.MatrixSize();
+    }
+
+    template <typename Ptr>
+    Ptr Find(Graph& graph, int key, bool count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(version_ != graph.Version()) Reset(graph.Version());
+        auto it = index_.find(key);
+        if(it == index_.end()) {
+            if(count) ++misses_;
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        ++hits_;
+        if constexpr (std::is_same_v<Ptr, TreePtr>) return it->second->tree;
+        else return it->second->matrix;
+    }
+
+    void Insert(uint64_t version, int key, Entry entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(version != version_ || entry.bytes > memory_limit_ || index_.count(key)) return;
+        memory_usage_ += entry.bytes;
+        entries_.push_front(std::move(entry));
+        index_[key] = entries_.begin();
+        while(memory_usage_ > memory_limit_) {
+            memory_usage_ -= entries_.back().bytes;
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+        }
+    }
+
+    void Reset(uint64_t version) {
+        entries_.clear();
+        index_.clear();
+        memory_usage_ = 0;
+        version_ = version;
+    }
+
+}; // ShortestPathCache
+
+}; // namespace s21
+
+#endif // PATH_CACHE_HPP
@@ -0,0 +1,23 @@
+#ifndef PATH_TREE_HPP
+#define PATH_TREE_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace s21 {
+
+// Single-source result indexed from 0. Unreachable vertices have distance -1,
+// the source and unreachable vertices have parent -1.
+struct ShortestPathTree {
+    std::vector<int> distance;
+    std::vector<int> parent;
+    size_t source;
+
+    inline size_t MemoryUsage() const noexcept {
+        return sizeof(*this) + (distance.capacity() + parent.capacity()) * sizeof(int);
+    }
+};
+
+};
+
+#endif // PATH_TREE_HPP
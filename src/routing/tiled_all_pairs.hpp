@@ -0,0 +1,232 @@
+#ifndef TILED_ALL_PAIRS_HPP
+#define TILED_ALL_PAIRS_HPP
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "../graph/s21_graph.h"
+
+namespace s21 {
+
+#define DEFAULT_TILE_BUDGET (256 << 20)
+
+// Blocked Floyd-Warshall over a distance matrix kept in a file. At most three
+// tiles are held in memory, their size is derived from the memory budget.
+// The file records the last finished block round, so an interrupted run on the
+// same graph continues from there. Unreachable pairs hold -1.
+class TiledAllPairs {
+public:
+    // Receives finished and total block rounds, returning false interrupts the run.
+    using Progress = std::function<bool(size_t, size_t)>;
+
+    explicit TiledAllPairs(std::string path, size_t memory_budget = DEFAULT_TILE_BUDGET)
+        : path_(path)
+        , memory_budget_(memory_budget)
+        , fd_(-1)
+        , header_()
+    {
+    }
+
+    TiledAllPairs(const TiledAllPairs&) = delete;
+
+    TiledAllPairs& operator=(const TiledAllPairs&) = delete;
+
+    ~TiledAllPairs() { Close(); }
+
+    bool Run(Graph& graph, Progress progress = nullptr) {
+        size_t size = graph.MatrixSize();
+        size_t tile = std::max<size_t>(1, std::min<size_t>(size, static_cast<size_t>(std::sqrt(memory_budget_ / (3 * sizeof(int))))));
+        uint64_t hash = GraphHash(graph);
+        if(!Open()) return false;
+        if(!ReadHeader() || header_.size != size || header_.tile != tile || header_.hash != hash) {
+            header_ = Header{{'S', '2', '1', 'A', 'P', 'S', 'P', '\0'}, size, tile, hash, 0};
+            if(ftruncate(fd_, 0) != 0 || !Initialize(graph) || !WriteHeader()) return false;
+        }
+
+        size_t rounds = Rounds();
+        tiles_[0].assign(tile * tile, 0);
+        tiles_[1].assign(tile * tile, 0);
+        tiles_[2].assign(tile * tile, 0);
+        while(header_.round < rounds) {
+            if(!BlockRound(header_.round)) return false;
+            ++header_.round;
+            if(!WriteHeader() || fdatasync(fd_) != 0) return false;
+            if(progress && !progress(header_.round, rounds)) return false;
+        }
+        for(auto& it : tiles_) std::vector<int>().swap(it);
+        return true;
+    }
+
+    inline bool Finished() const noexcept { return fd_ >= 0 && header_.size > 0 && header_.round == Rounds(); }
+
+    inline size_t TileSize() const noexcept { return header_.tile; }
+
+    // Row numbered from 0 as in s21::Matrix.
+    bool ReadRow(size_t row, std::vector<int>& result) {
+        if(fd_ < 0 && (!Open() || !ReadHeader())) return false;
+        if(row >= header_.size) return false;
+        result.resize(header_.size);
+        return Read(Offset(row, 0), result.data(), header_.size);
+    }
+
+    int Distance(size_t i, size_t z) {
+        int res = -1;
+        if(fd_ < 0 && (!Open() || !ReadHeader())) return res;
+        if(i < header_.size && z < header_.size) Read(Offset(i, z), &res, 1);
+        return res;
+    }
+
+private:
+    struct Header {
+        char magic[8];
+        uint64_t size;
+        uint64_t tile;
+        uint64_t hash;
+        uint64_t round;
+    };
+
+    static constexpr int INF = -1;
+
+    std::string path_;
+    size_t memory_budget_;
+    int fd_;
+    Header header_;
+    std::vector<int> tiles_[3];
+
+    inline size_t Rounds() const noexcept { return header_.tile == 0 ? 0 : (header_.size + header_.tile - 1) / header_.tile; }
+
+    inline off_t Offset(size_t i, size_t z) const noexcept {
+        return static_cast<off_t>(sizeof(Header) + (i * header_.size + z) * sizeof(int));
+    }
+
+    bool Open() {
+        if(fd_ < 0) fd_ = open(path_.c_str(), O_RDWR | O_CREAT, 0644);
+        return fd_ >= 0;
+    }
+
+    void Close() {
+        if(fd_ >= 0) close(fd_);
+        fd_ = -1;
+    }
+
+    bool Read(off_t offset, int* data, size_t count) {
+        size_t bytes = count * sizeof(int);
+        return pread(fd_, data, bytes, offset) == static_cast<ssize_t>(bytes);
+    }
+
+    bool Write(off_t offset, const int* data, size_t count) {
+        size_t bytes = count * sizeof(int);
+        return pwrite(fd_, data, bytes, offset) == static_cast<ssize_t>(bytes);
+    }
+
+    bool ReadHeader() {
+        Header header;
+        if(pread(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) return false;
+        if(std::strncmp(header.magic, "S21APSP", 8) != 0) return false;
+        header_ = header;
+        return true;
+    }
+
+    bool WriteHeader() { return pwrite(fd_, &header_, sizeof(header_), 0) == static_cast<ssize_t>(sizeof(header_)); }
+
+    static uint64_t GraphHash(Graph& graph) {
+        uint64_t hash = 14695981039346656037ULL;
+        for(size_t i = 0; i < graph.MatrixSize(); ++i) {
+            for(size_t z = 0; z < graph.MatrixSize(); ++z) {
+                hash ^= static_cast<uint64_t>(static_cast<uint32_t>(graph(i, z)));
+                hash *= 1099511628211ULL;
+            }
+        }
+        return hash;
+    }
+
+    bool Initialize(Graph& graph) {
+        std::vector<int> row(header_.size);
+        for(size_t i = 0; i < header_.size; ++i) {
+            for(size_t z = 0; z < header_.size; ++z) row[z] = i == z ? 0 : (graph(i, z) > 0 ? graph(i, z) : INF);
+            if(!Write(Offset(i, 0), row.data(), row.size())) return false;
+        }
+        return true;
+    }
+
+    inline size_t Extent(size_t block) const noexcept { return std::min(header_.tile, header_.size - block * header_.tile); }
+
+    bool LoadTile(size_t bi, size_t bj, std::vector<int>& tile) {
+        size_t rows = Extent(bi), cols = Extent(bj);
+        for(size_t r = 0; r < rows; ++r) {
+            if(!Read(Offset(bi * header_.tile + r, bj * header_.tile), tile.data() + r * header_.tile, cols)) return false;
+        }
+        return true;
+    }
+
+    bool StoreTile(size_t bi, size_t bj, const std::vector<int>& tile) {
+        size_t rows = Extent(bi), cols = Extent(bj);
+        for(size_t r = 0; r < rows; ++r) {
+            if(!Write(Offset(bi * header_.tile + r, bj * header_.tile), tile.data() + r * header_.tile, cols)) return false;
+        }
+        return true;
+    }
+
+    // c(i, j) = min(c(i, j), a(i, k) + b(k, j)); the tiles may alias.
+    void Relax(int* c, const int* a, const int* b, size_t rows, size_t cols, size_t depth) const {
+        size_t stride = header_.tile;
+        for(size_t k = 0; k < depth; ++k) {
+            for(size_t i = 0; i < rows; ++i) {
+                int left = a[i * stride + k];
+                if(left == INF) continue;
+                const int* right = b + k * stride;
+                int* out = c + i * stride;
+                for(size_t j = 0; j < cols; ++j) {
+                    if(right[j] == INF) continue;
+                    int sum = left + right[j];
+                    if(out[j] == INF || sum < out[j]) out[j] = sum;
+                }
+            }
+        }
+    }
+
+    bool BlockRound(size_t kb) {
+        size_t blocks = Rounds(), depth = Extent(kb);
+        std::vector<int>& diagonal = tiles_[0];
+        std::vector<int>& first = tiles_[1];
+        std::vector<int>& second = tiles_[2];
+
+        if(!LoadTile(kb, kb, diagonal)) return false;
+        Relax(diagonal.data(), diagonal.data(), diagonal.data(), depth, depth, depth);
+        if(!StoreTile(kb, kb, diagonal)) return false;
+
+        for(size_t b = 0; b < blocks; ++b) {
+            if(b == kb) continue;
+            if(!LoadTile(kb, b, first)) return false;
+            Relax(first.data(), diagonal.data(), first.data(), depth, Extent(b), depth);
+            if(!StoreTile(kb, b, first)) return false;
+            if(!LoadTile(b, kb, first)) return false;
+            Relax(first.data(), first.data(), diagonal.data(), Extent(b), depth, depth);
+            if(!StoreTile(b, kb, first)) return false;
+        }
+
+        std::vector<int>& row = diagonal;
+        for(size_t bi = 0; bi < blocks; ++bi) {
+            if(bi == kb) continue;
+            if(!LoadTile(bi, kb, row)) return false;
+            for(size_t bj = 0; bj < blocks; ++bj) {
+                if(bj == kb) continue;
+                if(!LoadTile(kb, bj, first) || !LoadTile(bi, bj, second)) return false;
+                Relax(second.data(), row.data(), first.data(), Extent(bi), Extent(bj), depth);
+                if(!StoreTile(bi, bj, second)) return false;
+            }
+        }
+        return true;
+    }
+
+}; // TiledAllPairs
+
+}; // namespace s21
+
+#endif // TILED_ALL_PAIRS_HPP
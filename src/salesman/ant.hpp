@@ -1,13 +1,20 @@
 #ifndef ANT_HPP
 #define ANT_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 
+#include "ant_kernel.h"
 #include "path.hpp"
 
 namespace s21 {
 
+// Each step weighs the moves of the current vertex in contiguous float arrays,
+// the choice values of the path times a mask that is 1 for unvisited vertices,
+// with the packed kernel of ant_kernel.cc. It leaves the sum of every block of
+// weights, so the pick walks those sums and then a single block. A step costs
+// no pow calls, no sort and no allocations once the buffers have grown.
 class Ant {
 public:
     Ant() = delete;
@@ -16,7 +23,12 @@ public:
         : alpha_(alpha)
         , beta_(beta)
         , road_()
-        , possible_ways_()
+        , ways_()
+        , weights_()
+        , blocks_()
+        , open_()
+        , mask_()
+        , row_()
     {
         road_.push_back(vertex);
     }
@@ -24,24 +36,17 @@ public:
     ~Ant() = default;
 
     void Run(s21::Path& path) {
-        while(CanMove(path)) {
-            std::vector<std::pair<size_t, double>> ways_chance;
-            double wish_sum = 0;
-
-            for(auto it : possible_ways_) {
-                double path_factor = std::pow(std::pow(path.Distance()(road_.back(), it), alpha_), -1);
-                double pheromone_factor = std::pow(path.Pheromones()(road_.back(), it), beta_);
-                double attraction = path_factor * pheromone_factor;
-                wish_sum += attraction;
-                ways_chance.push_back(std::make_pair(it, attraction));
-            }
-
-            for(size_t i = 0; i < ways_chance.size(); ++i) {
-                ways_chance[i].second /= wish_sum;
-            }
-
-            if(ways_chance.size() > 0) road_.push_back(RandomDirection(ways_chance));
-
+        path.PrepareChoice(alpha_, beta_);
+        size_t size = path.Distance().MatrixSize();
+        open_.assign(size, 1.0f);
+        row_.resize(size);
+        for(auto it : road_) open_[it] = 0.0f;
+        std::default_random_engine engine{std::random_device()()};
+        while(road_.size() < size) {
+            size_t next = Step(path, engine);
+            if(next == size) break;
+            road_.push_back(next);
+            open_[next] = 0.0f;
         }
 
         if(path.Distance()(road_.back(), road_.front()) != 0) {
@@ -56,49 +61,71 @@ private:
     double alpha_;
     double beta_;
     std::vector<size_t> road_;
-    std::vector<size_t> possible_ways_;
-
-
-    bool CanMove(s21::Path& path) {
-        possible_ways_.clear();
-        size_t current_vertex = road_.back();
-        for(size_t i = 0; i < path.Distance().Rows(); ++i) {
-            if(i != current_vertex && path.Distance()(current_vertex, i) != 0 && !Contains(road_, i)) {
-                possible_ways_.push_back(i);
+    std::vector<size_t> ways_;
+    std::vector<float> weights_;
+    std::vector<float> blocks_;
+    // 1 for unvisited vertices, 0 for visited ones, so masking is a multiplication.
+    std::vector<float> open_;
+    // The mask of the candidates in their order, and the row buffer of the triangle.
+    std::vector<float> mask_;
+    std::vector<float> row_;
+
+    // Next vertex among the unvisited candidates, among all unvisited neighbours
+    // once they run out, the vertex count when there is none.
+    size_t Step(s21::Path& path, std::default_random_engine& engine) {
+        size_t current = road_.back(), size = open_.size();
+        if(path.HasCandidates()) {
+            const std::vector<size_t>& candidates = path.Candidates(current);
+            mask_.resize(candidates.size());
+            for(size_t i = 0; i < candidates.size(); ++i) mask_[i] = open_[candidates[i]];
+            float sum = Weigh(path.CandidateChoice(current), mask_.data(), candidates.size());
+            if(sum > 0.0f) return candidates[Pick(engine, sum)];
+
+            // Every open candidate underflowed, any of them will do.
+            ways_.clear();
+            for(size_t i = 0; i < candidates.size(); ++i) {
+                if(mask_[i] != 0.0f) ways_.push_back(candidates[i]);
             }
+            if(!ways_.empty()) return ways_[std::uniform_int_distribution<size_t>(0, ways_.size() - 1)(engine)];
         }
-        return !possible_ways_.empty();
-    }
 
-    bool Contains(std::vector<size_t>& vec, size_t el) {
-        for(auto it : vec) {
-            if(it == el) return true;
-        }
-        return false;
-    }
+        float sum = Weigh(path.ChoiceRow(current, row_.data()), open_.data(), size);
+        if(sum > 0.0f) return Pick(engine, sum);
 
-    size_t RandomDirection(std::vector<std::pair<size_t, double>>& vec) {
-        std::random_device rd;
-        std::default_random_engine eng(rd());
-        std::uniform_int_distribution<int> rnd(0, 100);
-        double rand_val = static_cast<double>(rnd(eng)) / 100.0;
-        std::sort(vec.begin(), vec.end(), Comparator);
-        size_t res = vec.back().first;
-
-        for(size_t i = 0; i < vec.size(); ++i) {
-            if(rand_val < vec[i].second) {
-                res = vec[i].first;
-                break;
-            }
+        // Every weight underflowed, any unvisited neighbour will do.
+        ways_.clear();
+        for(size_t i = 0; i < size; ++i) {
+            if(i != current && open_[i] != 0.0f && path.Distance()(current, i) != 0) ways_.push_back(i);
         }
-
-        return res;
+        if(ways_.empty()) return size;
+        return ways_[std::uniform_int_distribution<size_t>(0, ways_.size() - 1)(engine)];
     }
 
-    static bool Comparator(std::pair<size_t, double>& lhs, std::pair<size_t, double>& rhs) {
-        return lhs.second < rhs.second;
+    // Weights of count moves in weights_ and their block sums in blocks_.
+    float Weigh(const float* choice, const float* mask, size_t count) {
+        weights_.resize(count);
+        blocks_.resize((count + ANT_BLOCK - 1) / ANT_BLOCK);
+        return WeighMoves(choice, mask, count, weights_.data(), blocks_.data());
     }
 
+    // Index drawn with probability proportional to its weight, sum is the total
+    // returned by Weigh and has to be positive.
+    size_t Pick(std::default_random_engine& engine, float sum) {
+        const float* weights = weights_.data();
+        float target = std::uniform_real_distribution<float>(0.0f, sum)(engine);
+        float before = 0.0f;
+        size_t block = 0;
+        while(block + 1 < blocks_.size() && before + blocks_[block] <= target) before += blocks_[block++];
+        size_t end = std::min(weights_.size(), (block + 1) * ANT_BLOCK);
+        for(size_t i = block * ANT_BLOCK; i < end; ++i) {
+            before += weights[i];
+            if(before > target) return i;
+        }
+        // Rounding left the draw at or above the running total, the last positive
+        // weight up to this block takes it.
+        while(weights[end - 1] == 0.0f) --end;
+        return end - 1;
+    }
 
 }; // Ant
 
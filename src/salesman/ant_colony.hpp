@@ -4,16 +4,49 @@
 #include <vector>
 
 #include "ant.hpp"
+#include "local_search.hpp"
 #include "path.hpp"
 #include "tsmresult.hpp"
 
 namespace s21 {
 
+#define MMAS_EVAPORATION 0.98
+#define MMAS_BEST_PROBABILITY 0.05
+#define MMAS_GLOBAL_BEST_PERIOD 5
+#define MMAS_RESTART_ITERATIONS 15
+
+enum PheromoneUpdate {
+    AntSystem,
+    MaxMin
+};
+
+// Alpha weighs the distance and beta the pheromone of a move, evaporation is
+// the share of the trails MaxMin keeps each iteration.
+struct ColonyParameters {
+    double alpha = 2.0;
+    double beta = 1.0;
+    double evaporation = MMAS_EVAPORATION;
+};
+
+// AntSystem lets every ant deposit and evaporates after each of them. MaxMin
+// evaporates once per iteration, deposits only the iteration best tour (the best
+// tour so far every MMAS_GLOBAL_BEST_PERIOD iterations), keeps the trails within
+// bounds derived from the best length and resets them when the best stagnates.
 class AntColony {
 public:
-    AntColony(s21::Graph& graph)
-        : path_(graph)
-        , ants_(graph.MatrixSize(), Ant(0))
+    AntColony(s21::Graph& graph, LocalSearchMode local_search = BestTour, size_t candidates = CANDIDATE_LIST_SIZE,
+              PheromoneUpdate update = AntSystem)
+        : path_(graph, candidates)
+        , ants_()
+        , local_search_mode_(local_search)
+        , local_search_(path_.Distance())
+        , update_(update)
+        , parameters_()
+        , best_{{}, INFINITY}
+        , iteration_(0)
+        , stagnation_(0)
+        , min_pheromone_(0)
+        , max_pheromone_(0)
     {
     }
 
@@ -21,14 +54,23 @@ public:
 
     void CreateAnts(size_t total_ants) {
         ants_.clear();
+        ants_.reserve(total_ants);
         for(size_t i = 0; i < total_ants; ++i)
-            ants_.push_back(Ant(RandomNum(path_.Distance().Rows())));
+            ants_.emplace_back(RandomNum(path_.Distance().MatrixSize()), parameters_.alpha, parameters_.beta);
     }
 
     void ReleaseAnts() {
         for(size_t i = 0; i < ants_.size(); ++i) {
             ants_[i].Run(path_);
         }
+        ImproveTours();
+        if(ants_.empty()) return;
+        std::vector<size_t>& road = ants_[BestAnt()].Road();
+        bool improved = Record(road);
+        if(update_ == MaxMin) {
+            MaxMinUpdate(road, improved);
+            return;
+        }
         for(size_t i = 0; i < ants_.size(); ++i) {
             path_.UpdatePheromones(ants_[i].Road());
         }
@@ -46,9 +88,130 @@ public:
         return res;
     }
 
+    inline void SetLocalSearch(LocalSearchMode mode) noexcept { local_search_mode_ = mode; }
+
+    inline void SetPheromoneUpdate(PheromoneUpdate update) noexcept { update_ = update; }
+
+    inline void SetParameters(const ColonyParameters& parameters) noexcept { parameters_ = parameters; }
+
+    inline const ColonyParameters& Parameters() const noexcept { return parameters_; }
+
+    // Shortest complete tour of all iterations so far.
+    inline const s21::TsmResult& BestResult() const noexcept { return best_; }
+
+    // Takes a tour found elsewhere, it becomes the best tour and lays a trail if it
+    // is shorter than the own best.
+    bool Immigrate(const s21::TsmResult& tour) {
+        std::vector<size_t> road = tour.vertices;
+        if(!Record(road)) return false;
+        if(update_ == MaxMin) {
+            bool first = max_pheromone_ == 0;
+            SetPheromoneBounds(road.size() - 1);
+            if(first) path_.ResetPheromones(max_pheromone_);
+            path_.DepositPheromones(road, 1.0 / best_.distance);
+            path_.ClampPheromones(min_pheromone_, max_pheromone_);
+        } else {
+            path_.UpdatePheromones(road);
+        }
+        return true;
+    }
+
+    // Starts from a constructed tour instead of flat trails: it becomes the best
+    // tour, every trail gets the level its length implies and its edges get it twice.
+    bool Seed(const s21::TsmResult& tour) {
+        std::vector<size_t> road = tour.vertices;
+        if(!Record(road)) return false;
+        double level = static_cast<double>(road.size() - 1) / best_.distance;
+        if(update_ == MaxMin) {
+            SetPheromoneBounds(road.size() - 1);
+            level = max_pheromone_;
+        }
+        path_.ResetPheromones(level);
+        path_.DepositPheromones(road, level);
+        if(update_ == MaxMin) path_.ClampPheromones(min_pheromone_, max_pheromone_);
+        return true;
+    }
+
+    inline double MinPheromone() const noexcept { return min_pheromone_; }
+
+    inline double MaxPheromone() const noexcept { return max_pheromone_; }
+
 private:
     s21::Path path_;
     std::vector<Ant> ants_;
+    LocalSearchMode local_search_mode_;
+    s21::LocalSearch local_search_;
+    PheromoneUpdate update_;
+    ColonyParameters parameters_;
+    s21::TsmResult best_;
+    size_t iteration_;
+    size_t stagnation_;
+    double min_pheromone_;
+    double max_pheromone_;
+
+    // Polishes the tours before they lay pheromones, so improvements are reinforced.
+    void ImproveTours() {
+        if(local_search_mode_ == EveryTour) {
+            for(auto& it : ants_) local_search_.Improve(it.Road());
+        } else if(local_search_mode_ == BestTour && !ants_.empty()) {
+            local_search_.Improve(ants_[BestAnt()].Road());
+        }
+    }
+
+    size_t BestAnt() {
+        size_t best = 0;
+        for(size_t i = 1; i < ants_.size(); ++i) {
+            if(Shorter(ants_[i].Road(), ants_[best].Road())) best = i;
+        }
+        return best;
+    }
+
+    // Keeps a complete tour shorter than the best one.
+    bool Record(std::vector<size_t>& road) {
+        size_t size = path_.Distance().MatrixSize();
+        if(size == 0 || road.size() != size + 1 || road.front() != road.back()) return false;
+        double length = static_cast<double>(path_.CalculatePathLength(road));
+        if(length >= best_.distance) return false;
+        best_.vertices = road;
+        best_.distance = length;
+        return true;
+    }
+
+    void MaxMinUpdate(std::vector<size_t>& road, bool improved) {
+        size_t size = path_.Distance().MatrixSize();
+        if(size < 2 || road.size() != size + 1) return;
+        ++iteration_;
+        if(improved) {
+            bool first = max_pheromone_ == 0;
+            stagnation_ = 0;
+            SetPheromoneBounds(size);
+            if(first) path_.ResetPheromones(max_pheromone_);
+        } else if(++stagnation_ >= MMAS_RESTART_ITERATIONS) {
+            stagnation_ = 0;
+            path_.ResetPheromones(max_pheromone_);
+            return;
+        }
+        path_.EvaporatePheromones(parameters_.evaporation);
+        if(iteration_ % MMAS_GLOBAL_BEST_PERIOD == 0) {
+            path_.DepositPheromones(best_.vertices, 1.0 / best_.distance);
+        } else {
+            path_.DepositPheromones(road, 1.0 / path_.CalculatePathLength(road));
+        }
+        path_.ClampPheromones(min_pheromone_, max_pheromone_);
+    }
+
+    void SetPheromoneBounds(size_t size) {
+        max_pheromone_ = 1.0 / ((1.0 - parameters_.evaporation) * best_.distance);
+        double root = std::pow(MMAS_BEST_PROBABILITY, 1.0 / static_cast<double>(size));
+        double choices = std::max(1.0, static_cast<double>(size) / 2.0 - 1.0);
+        min_pheromone_ = std::min(max_pheromone_, max_pheromone_ * (1.0 - root) / (choices * root));
+    }
+
+    // Complete tours first, then by length.
+    bool Shorter(std::vector<size_t>& lhs, std::vector<size_t>& rhs) {
+        if(lhs.size() != rhs.size()) return lhs.size() > rhs.size();
+        return path_.CalculatePathLength(lhs) < path_.CalculatePathLength(rhs);
+    }
 
     size_t RandomNum(size_t max) {
         std::random_device rd;
@@ -0,0 +1,35 @@
+#include "ant_kernel.h"
+
+namespace s21 {
+
+float WeighMoves(const float* choice, const float* mask, size_t count,
+                 float* weights, float* blocks) {
+  float total = 0.0f;
+  size_t full = count - count % ANT_BLOCK;
+  // The products go through a local array, so there is nothing to check for
+  // aliasing, and the halves are added pairwise instead of in one serial chain.
+  for (size_t i = 0; i < full; i += ANT_BLOCK) {
+    float lanes[ANT_BLOCK];
+    for (size_t l = 0; l < ANT_BLOCK; ++l) {
+      lanes[l] = choice[i + l] * mask[i + l];
+    }
+    for (size_t l = 0; l < ANT_BLOCK; ++l) weights[i + l] = lanes[l];
+    for (size_t width = ANT_BLOCK / 2; width > 0; width /= 2) {
+      for (size_t l = 0; l < width; ++l) lanes[l] += lanes[l + width];
+    }
+    *blocks++ = lanes[0];
+    total += lanes[0];
+  }
+  if (full < count) {
+    float tail = 0.0f;
+    for (size_t i = full; i < count; ++i) {
+      weights[i] = choice[i] * mask[i];
+      tail += weights[i];
+    }
+    *blocks = tail;
+    total += tail;
+  }
+  return total;
+}
+
+}  // namespace s21
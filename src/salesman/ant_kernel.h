@@ -0,0 +1,18 @@
+#ifndef ANT_KERNEL_H
+#define ANT_KERNEL_H
+
+#include <cstddef>
+
+namespace s21 {
+
+#define ANT_BLOCK 16
+
+// Stores choice[i] * mask[i] of count moves in weights and the sum of every
+// ANT_BLOCK of them in blocks, which needs room for count / ANT_BLOCK rounded
+// up. Returns the total. Built on its own with KERNEL_FLAGS from the Makefile,
+// so the blocks compile to packed float operations in every build.
+float WeighMoves(const float* choice, const float* mask, size_t count, float* weights, float* blocks);
+
+}; // namespace s21
+
+#endif // ANT_KERNEL_H
@@ -0,0 +1,340 @@
+#ifndef BRANCH_AND_BOUND_HPP
+#define BRANCH_AND_BOUND_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "../graph/s21_graph.h"
+#include "tour_construction.hpp"
+#include "tsmresult.hpp"
+
+namespace s21 {
+
+#define BRANCH_AND_BOUND_MAX_NODES (1 << 22)
+#define BRANCH_AND_BOUND_ROOT_ASCENT 100
+#define BRANCH_AND_BOUND_NODE_ASCENT 5
+#define BRANCH_AND_BOUND_ASCENT_PATIENCE 5
+
+// Best-first search over tours starting at vertex 0, shared by several worker
+// threads. A partial tour is bounded by the reduced cost matrix of the rest of
+// the problem and, for symmetric graphs, by the Held-Karp bound: a 1-tree at
+// the root and a spanning tree of the vertices still to connect below it, both
+// under vertex penalties raised by subgradient ascent. The root runs
+// BRANCH_AND_BOUND_ROOT_ASCENT steps, every other node continues from the root
+// penalties for BRANCH_AND_BOUND_NODE_ASCENT steps.
+class BranchAndBound {
+public:
+    explicit BranchAndBound(size_t threads = std::thread::hardware_concurrency())
+        : threads_(std::max<size_t>(1, threads))
+    {
+    }
+
+    ~BranchAndBound() = default;
+
+    // Stops when the budget runs out, the tour is then as good as the gap shows.
+    // The incumbent may be empty, the constructed tours are always tried too.
+    TsmBoundedResult Solve(const Graph& graph, std::chrono::milliseconds budget, const TsmResult& incumbent = TsmResult()) const {
+        Search search(graph, std::chrono::steady_clock::now() + budget);
+        search.Offer(incumbent.vertices);
+        search.Offer(TourConstruction::NearestNeighbourTour(graph, graph.MatrixSize()).vertices);
+        search.Offer(TourConstruction::Build(graph).vertices);
+
+        size_t size = graph.MatrixSize();
+        if(size > 0) {
+            Node root{0, 0, {0}};
+            search.Ascend();
+            root.bound = search.Bound(root, search.best);
+            if(root.bound < search.best) search.queue.push(std::move(root));
+        }
+        std::vector<std::future<void>> tasks;
+        for(size_t t = 1; t < threads_; ++t) tasks.emplace_back(std::async(std::launch::async, [&]() { search.Work(); }));
+        search.Work();
+        for(auto& it : tasks) it.wait();
+
+        TsmBoundedResult res;
+        res.tour.vertices = search.tour;
+        res.tour.distance = search.tour.empty() ? INFINITY : static_cast<double>(search.best);
+        int64_t lower = search.best;
+        if(!search.queue.empty()) lower = std::min(lower, search.queue.top().bound);
+        res.lower_bound = search.tour.empty() && search.queue.empty() ? INFINITY : static_cast<double>(lower);
+        res.gap = search.tour.empty() ? INFINITY : (search.best == 0 ? 0.0 : static_cast<double>(search.best - lower) / search.best);
+        return res;
+    }
+
+private:
+    struct Node {
+        int64_t bound;
+        int64_t cost;
+        std::vector<size_t> path;
+
+        // Lowest bound first, deeper paths first among equal bounds.
+        bool operator<(const Node& other) const {
+            return bound != other.bound ? bound > other.bound : path.size() < other.path.size();
+        }
+    };
+
+    struct Search {
+        static constexpr int64_t NONE = INT64_MAX;
+
+        const Graph& graph;
+        std::chrono::steady_clock::time_point deadline;
+        bool symmetric;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::priority_queue<Node> queue;
+        size_t active = 0;
+        size_t nodes = 0;
+        bool stopped = false;
+        int64_t best = NONE;
+        std::vector<size_t> tour;
+        // Held-Karp multipliers of the root, where the ascent of every node starts.
+        std::vector<double> penalty;
+
+        Search(const Graph& source, std::chrono::steady_clock::time_point until)
+            : graph(source)
+            , deadline(until)
+            , symmetric(true)
+            , penalty(source.MatrixSize(), 0.0)
+        {
+            for(size_t i = 0; i < graph.MatrixSize() && symmetric; ++i) {
+                for(size_t z = i + 1; z < graph.MatrixSize() && symmetric; ++z) symmetric = graph(i, z) == graph(z, i);
+            }
+        }
+
+        // Takes a closed tour if it beats the incumbent, rotated to start at vertex 0.
+        void Offer(std::vector<size_t> road) {
+            size_t size = graph.MatrixSize();
+            if(size == 0 || road.size() != size + 1 || road.front() != road.back()) return;
+            road.pop_back();
+            std::rotate(road.begin(), std::find(road.begin(), road.end(), 0), road.end());
+            road.push_back(road.front());
+            std::vector<bool> seen(size, false);
+            int64_t length = 0;
+            for(size_t i = 0; i < size; ++i) {
+                if(road[i] >= size || seen[road[i]]) return;
+                seen[road[i]] = true;
+                int weight = graph(road[i], road[i + 1]);
+                if(weight <= 0 && size > 1) return;
+                length += weight;
+            }
+            if(length < best) {
+                best = length;
+                tour = road;
+            }
+        }
+
+        void Work() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(true) {
+                wake.wait(lock, [&]() { return stopped || !queue.empty() || active == 0; });
+                if(stopped || queue.empty()) break;
+                if(std::chrono::steady_clock::now() >= deadline || nodes >= BRANCH_AND_BOUND_MAX_NODES) {
+                    stopped = true;
+                    wake.notify_all();
+                    break;
+                }
+                Node node = queue.top();
+                queue.pop();
+                if(node.bound >= best) {
+                    queue = std::priority_queue<Node>();
+                    wake.notify_all();
+                    continue;
+                }
+                ++active;
+                ++nodes;
+                int64_t upper = best;
+                lock.unlock();
+                std::vector<Node> children = Branch(node, upper);
+                lock.lock();
+                for(auto& it : children) {
+                    if(it.path.size() == graph.MatrixSize() + 1) {
+                        Offer(std::move(it.path));
+                    } else if(it.bound < best) {
+                        queue.push(std::move(it));
+                    }
+                }
+                --active;
+                wake.notify_all();
+            }
+        }
+
+        std::vector<Node> Branch(const Node& node, int64_t upper) const {
+            size_t size = graph.MatrixSize();
+            std::vector<Node> res;
+            std::vector<bool> visited(size, false);
+            for(auto it : node.path) visited[it] = true;
+            size_t last = node.path.back();
+            bool closing = node.path.size() == size;
+            for(size_t i = 0; i < size; ++i) {
+                if((closing ? i != 0 : visited[i]) || graph(last, i) <= 0) continue;
+                Node child{0, node.cost + graph(last, i), node.path};
+                child.path.push_back(i);
+                child.bound = closing ? child.cost : Bound(child, upper);
+                if(child.bound != NONE) res.push_back(std::move(child));
+            }
+            return res;
+        }
+
+        // Runs the long ascent of the root 1-tree once the incumbent is known.
+        void Ascend() {
+            size_t size = graph.MatrixSize();
+            if(!symmetric || best == NONE || size < 3) return;
+            std::vector<size_t> vertices(size);
+            for(size_t i = 0; i < size; ++i) vertices[i] = i;
+            TreeBound(vertices, true, penalty, best, BRANCH_AND_BOUND_ROOT_ASCENT);
+        }
+
+        // Lower bound of every tour extending the path, NONE when there is none.
+        // Upper is the incumbent length the subgradient steps aim at.
+        int64_t Bound(const Node& node, int64_t upper) const {
+            size_t size = graph.MatrixSize(), last = node.path.back();
+            std::vector<bool> visited(size, false);
+            for(auto it : node.path) visited[it] = true;
+            std::vector<size_t> rows = {last}, cols = {0};
+            for(size_t i = 0; i < size; ++i) {
+                if(!visited[i]) {
+                    rows.push_back(i);
+                    cols.push_back(i);
+                }
+            }
+            if(rows.size() == 1) return graph(last, 0) > 0 ? node.cost + graph(last, 0) : NONE;
+
+            auto allowed = [&](size_t from, size_t to) {
+                return from != to && graph(from, to) > 0 && !(from == last && to == 0);
+            };
+            int64_t reduction = 0;
+            std::vector<int64_t> row_min(rows.size(), NONE);
+            for(size_t r = 0; r < rows.size(); ++r) {
+                for(auto c : cols) {
+                    if(allowed(rows[r], c)) row_min[r] = std::min<int64_t>(row_min[r], graph(rows[r], c));
+                }
+                if(row_min[r] == NONE) return NONE;
+                reduction += row_min[r];
+            }
+            for(auto c : cols) {
+                int64_t col_min = NONE;
+                for(size_t r = 0; r < rows.size(); ++r) {
+                    if(allowed(rows[r], c)) col_min = std::min<int64_t>(col_min, graph(rows[r], c) - row_min[r]);
+                }
+                if(col_min == NONE) return NONE;
+                reduction += col_min;
+            }
+
+            int64_t tree = 0;
+            if(symmetric) {
+                if(last != 0) rows.push_back(0);
+                std::vector<double> local = penalty;
+                tree = TreeBound(rows, last == 0, local, upper, upper == NONE ? 0 : BRANCH_AND_BOUND_NODE_ASCENT);
+                if(tree == NONE) return NONE;
+            }
+            return node.cost + std::max(reduction, tree);
+        }
+
+        // Best bound over the ascent steps, NONE when the vertices cannot be
+        // connected. With cycle the first vertex joins a spanning tree of the others
+        // by its two cheapest edges and every vertex should have degree 2, otherwise
+        // the tree spans all vertices and the first and last one should be leaves.
+        // Multipliers end up with the multipliers of the best step.
+        int64_t TreeBound(const std::vector<size_t>& vertices, bool cycle, std::vector<double>& multipliers, int64_t upper,
+                          size_t iterations) const {
+            size_t count = vertices.size();
+            if(count < 3) return 0;
+            std::vector<int> target(count, 2), degree(count);
+            if(!cycle) target.front() = target.back() = 1;
+            std::vector<double> best_multipliers = multipliers;
+            double best_value = -INFINITY, lambda = 2.0;
+            size_t stale = 0;
+            for(size_t step = 0; step <= iterations; ++step) {
+                double value = OneTree(vertices, cycle, multipliers, degree);
+                if(std::isnan(value)) return NONE;
+                for(size_t i = 0; i < count; ++i) value -= target[i] * multipliers[vertices[i]];
+                if(value > best_value) {
+                    best_value = value;
+                    best_multipliers = multipliers;
+                    stale = 0;
+                } else if(++stale == BRANCH_AND_BOUND_ASCENT_PATIENCE) {
+                    lambda /= 2.0;
+                    stale = 0;
+                }
+                double norm = 0;
+                for(size_t i = 0; i < count; ++i) norm += (degree[i] - target[i]) * (degree[i] - target[i]);
+                if(norm == 0 || step == iterations || static_cast<double>(upper) <= value) break;
+                double length = lambda * (static_cast<double>(upper) - value) / norm;
+                for(size_t i = 0; i < count; ++i) multipliers[vertices[i]] += length * (degree[i] - target[i]);
+            }
+            multipliers = best_multipliers;
+            return static_cast<int64_t>(std::ceil(best_value - 1e-6));
+        }
+
+        // Weight of the 1-tree or spanning tree under the penalties, NaN when there is
+        // none. Degree receives the degree of every vertex in it.
+        double OneTree(const std::vector<size_t>& vertices, bool cycle, const std::vector<double>& multipliers,
+                       std::vector<int>& degree) const {
+            size_t count = vertices.size(), first = cycle ? 1 : 0;
+            auto weight = [&](size_t i, size_t z) {
+                int value = graph(vertices[i], vertices[z]);
+                return value > 0 ? value + multipliers[vertices[i]] + multipliers[vertices[z]] : INFINITY;
+            };
+            std::vector<double> key(count, INFINITY);
+            std::vector<size_t> parent(count, count);
+            std::vector<bool> taken(count, false);
+            std::fill(degree.begin(), degree.end(), 0);
+            double res = 0;
+            key[first] = 0;
+            for(size_t step = first; step < count; ++step) {
+                size_t next = count;
+                for(size_t i = first; i < count; ++i) {
+                    if(!taken[i] && (next == count || key[i] < key[next])) next = i;
+                }
+                if(std::isinf(key[next])) return NAN;
+                taken[next] = true;
+                res += key[next];
+                if(parent[next] != count) {
+                    ++degree[next];
+                    ++degree[parent[next]];
+                }
+                for(size_t i = first; i < count; ++i) {
+                    double value = weight(next, i);
+                    if(!taken[i] && value < key[i]) {
+                        key[i] = value;
+                        parent[i] = next;
+                    }
+                }
+            }
+            if(!cycle) return res;
+            size_t nearest[2] = {count, count};
+            for(size_t i = 1; i < count; ++i) {
+                double value = weight(0, i);
+                if(std::isinf(value)) continue;
+                if(nearest[0] == count || value < weight(0, nearest[0])) {
+                    nearest[1] = nearest[0];
+                    nearest[0] = i;
+                } else if(nearest[1] == count || value < weight(0, nearest[1])) {
+                    nearest[1] = i;
+                }
+            }
+            if(nearest[1] == count) return NAN;
+            for(auto it : nearest) {
+                res += weight(0, it);
+                ++degree[it];
+            }
+            degree[0] = 2;
+            return res;
+        }
+    };
+
+    size_t threads_;
+
+}; // BranchAndBound
+
+}; // namespace s21
+
+#endif // BRANCH_AND_BOUND_HPP
@@ -0,0 +1,134 @@
+#ifndef HELD_KARP_HPP
+#define HELD_KARP_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "../graph/s21_graph.h"
+#include "tsmresult.hpp"
+
+namespace s21 {
+
+#define HELD_KARP_MAX_VERTICES 22
+#define HELD_KARP_PARALLEL_MIN 4096
+
+// Exact dynamic programming over subsets of vertices, O(2^V * V^2) time and
+// 5 * 2^(V-1) * (V-1) bytes, about 220 MB at HELD_KARP_MAX_VERTICES. Tours
+// start and end at vertex 0, subsets of the same size are enumerated in place
+// by Gosper's hack and filled in parallel.
+class HeldKarp {
+public:
+    explicit HeldKarp(size_t threads = std::thread::hardware_concurrency())
+        : threads_(std::max<size_t>(1, threads))
+    {
+    }
+
+    ~HeldKarp() = default;
+
+    // Empty vertices and infinite distance when there is no tour or the graph is too large.
+    TsmResult Solve(const Graph& graph) const {
+        TsmResult res;
+        res.distance = INFINITY;
+        size_t size = graph.MatrixSize();
+        if(size == 0 || size > HELD_KARP_MAX_VERTICES) return res;
+        if(size == 1) {
+            res.vertices = {0, 0};
+            res.distance = 0;
+            return res;
+        }
+
+        size_t width = size - 1, full = (size_t(1) << width) - 1;
+        std::vector<int> cost((full + 1) * width, NONE);
+        std::vector<uint8_t> previous((full + 1) * width, 0);
+        for(size_t j = 0; j < width; ++j) {
+            if(graph(0, j + 1) > 0) cost[(size_t(1) << j) * width + j] = graph(0, j + 1);
+        }
+
+        for(size_t layer = 2; layer <= width; ++layer) {
+            // Every thread walks the whole layer and relaxes every nthreads-th mask.
+            auto fill = [&](size_t t, size_t step) {
+                size_t i = 0;
+                for(size_t mask = (size_t(1) << layer) - 1; mask <= full; mask = NextMask(mask), ++i) {
+                    if(i % step == t) Relax(graph, mask, width, cost, previous);
+                }
+            };
+            size_t nthreads = Binomial(width, layer) < HELD_KARP_PARALLEL_MIN ? 1 : threads_;
+            std::vector<std::future<void>> tasks;
+            for(size_t t = 1; t < nthreads; ++t) tasks.emplace_back(std::async(std::launch::async, fill, t, nthreads));
+            fill(0, nthreads);
+            for(auto& it : tasks) it.wait();
+        }
+
+        int best = NONE;
+        size_t last = width;
+        for(size_t j = 0; j < width; ++j) {
+            int value = cost[full * width + j], back = graph(j + 1, 0);
+            if(value == NONE || back <= 0) continue;
+            if(best == NONE || value + back < best) {
+                best = value + back;
+                last = j;
+            }
+        }
+        if(best == NONE) return res;
+
+        res.vertices.push_back(0);
+        for(size_t mask = full; mask != 0;) {
+            res.vertices.push_back(last + 1);
+            size_t before = previous[mask * width + last];
+            mask ^= size_t(1) << last;
+            last = before;
+        }
+        res.vertices.push_back(0);
+        std::reverse(res.vertices.begin(), res.vertices.end());
+        res.distance = best;
+        return res;
+    }
+
+private:
+    static constexpr int NONE = INT_MAX;
+
+    size_t threads_;
+
+    // Next larger mask with the same number of bits.
+    static inline size_t NextMask(size_t mask) noexcept {
+        size_t low = mask & (~mask + 1), ripple = mask + low;
+        return (((ripple ^ mask) >> 2) / low) | ripple;
+    }
+
+    static inline size_t Binomial(size_t n, size_t k) noexcept {
+        size_t res = 1;
+        for(size_t i = 1; i <= k; ++i) res = res * (n - k + i) / i;
+        return res;
+    }
+
+    // Cheapest paths from vertex 0 through mask ending at each of its vertices.
+    static void Relax(const Graph& graph, size_t mask, size_t width, std::vector<int>& cost, std::vector<uint8_t>& previous) {
+        for(size_t j = 0; j < width; ++j) {
+            if(!(mask & (size_t(1) << j))) continue;
+            size_t rest = mask ^ (size_t(1) << j);
+            int best = NONE;
+            uint8_t from = 0;
+            for(size_t i = 0; i < width; ++i) {
+                if(!(rest & (size_t(1) << i))) continue;
+                int value = cost[rest * width + i], weight = graph(i + 1, j + 1);
+                if(value == NONE || weight <= 0) continue;
+                if(best == NONE || value + weight < best) {
+                    best = value + weight;
+                    from = static_cast<uint8_t>(i);
+                }
+            }
+            cost[mask * width + j] = best;
+            previous[mask * width + j] = from;
+        }
+    }
+
+}; // HeldKarp
+
+}; // namespace s21
+
+#endif // HELD_KARP_HPP
@@ -0,0 +1,143 @@
+#ifndef ISLAND_MODEL_HPP
+#define ISLAND_MODEL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ant_colony.hpp"
+#include "tour_construction.hpp"
+#include "tsm_options.hpp"
+
+namespace s21 {
+
+#define ISLAND_MIGRATION_INTERVAL 10
+
+enum MigrationTopology {
+    Ring,
+    Star,
+    Complete
+};
+
+// Empty parameters give every island its own mix of alpha, beta and evaporation.
+struct IslandOptions {
+    size_t islands = std::max<size_t>(1, std::thread::hardware_concurrency());
+    // Colony iterations between two migrations.
+    size_t migration_interval = ISLAND_MIGRATION_INTERVAL;
+    MigrationTopology topology = Ring;
+    std::vector<ColonyParameters> parameters;
+};
+
+// Independent MaxMin colonies in parallel threads. After every migration
+// interval each island sends its best tour to its neighbours in the topology:
+// the next island on a ring, island 0 and back on a star, every other island
+// on a complete graph.
+class IslandModel {
+public:
+    IslandModel(s21::Graph& graph, const IslandOptions& options = IslandOptions())
+        : options_(options)
+        , ants_(graph.MatrixSize())
+    {
+        options_.islands = std::max<size_t>(1, options_.islands);
+        options_.migration_interval = std::max<size_t>(1, options_.migration_interval);
+        TsmResult seed = TourConstruction::Build(graph);
+        for(size_t i = 0; i < options_.islands; ++i) {
+            colonies_.push_back(std::make_unique<AntColony>(graph, BestTour, CANDIDATE_LIST_SIZE, MaxMin));
+            colonies_.back()->SetParameters(i < options_.parameters.size() ? options_.parameters[i] : DefaultParameters(i));
+            colonies_.back()->Seed(seed);
+        }
+    }
+
+    ~IslandModel() = default;
+
+    // Stagnation and the iteration cap count migration intervals.
+    TsmResult Run(const TsmOptions& options = TsmOptions()) {
+        auto start = std::chrono::steady_clock::now();
+        TsmResult best{{}, INFINITY};
+        size_t epochs = 0, steps_without_improves = 0;
+        while(true) {
+            std::vector<std::future<void>> tasks;
+            for(auto& it : colonies_) {
+                AntColony* colony = it.get();
+                tasks.emplace_back(std::async(std::launch::async, [this, colony]() {
+                    for(size_t i = 0; i < options_.migration_interval; ++i) {
+                        colony->CreateAnts(ants_);
+                        colony->ReleaseAnts();
+                    }
+                }));
+            }
+            for(auto& it : tasks) it.wait();
+            Migrate();
+            ++epochs;
+
+            const TsmResult& found = BestIsland().BestResult();
+            if(found.distance < best.distance) {
+                best = found;
+                steps_without_improves = 0;
+                if(options.on_improvement) options.on_improvement(best);
+            } else {
+                ++steps_without_improves;
+            }
+            if(steps_without_improves >= options.stagnation) break;
+            if(options.max_iterations > 0 && epochs >= options.max_iterations) break;
+            if(options.deadline.count() > 0 && std::chrono::steady_clock::now() - start >= options.deadline) break;
+            if(options.cancel && options.cancel->load()) break;
+        }
+        return best;
+    }
+
+    inline size_t Islands() const noexcept { return colonies_.size(); }
+
+    inline const AntColony& Island(size_t index) const { return *colonies_[index]; }
+
+private:
+    IslandOptions options_;
+    size_t ants_;
+    std::vector<std::unique_ptr<AntColony>> colonies_;
+
+    static ColonyParameters DefaultParameters(size_t island) {
+        static const double alphas[] = {2.0, 3.0, 1.0, 2.0};
+        static const double betas[] = {1.0, 1.0, 2.0, 2.0};
+        static const double evaporations[] = {0.98, 0.95, 0.9};
+        ColonyParameters res;
+        res.alpha = alphas[island % 4];
+        res.beta = betas[island % 4];
+        res.evaporation = evaporations[island % 3];
+        return res;
+    }
+
+    const AntColony& BestIsland() const {
+        size_t best = 0;
+        for(size_t i = 1; i < colonies_.size(); ++i) {
+            if(colonies_[i]->BestResult().distance < colonies_[best]->BestResult().distance) best = i;
+        }
+        return *colonies_[best];
+    }
+
+    // The tours are taken before any island receives one, so a tour moves one step per migration.
+    void Migrate() {
+        size_t count = colonies_.size();
+        std::vector<TsmResult> tours;
+        for(auto& it : colonies_) tours.push_back(it->BestResult());
+        for(size_t from = 0; from < count; ++from) {
+            if(tours[from].vertices.empty()) continue;
+            for(size_t to = 0; to < count; ++to) {
+                if(to != from && Connected(from, to)) colonies_[to]->Immigrate(tours[from]);
+            }
+        }
+    }
+
+    bool Connected(size_t from, size_t to) const {
+        if(options_.topology == Ring) return to == (from + 1) % colonies_.size();
+        if(options_.topology == Star) return from == 0 || to == 0;
+        return true;
+    }
+
+}; // IslandModel
+
+}; // namespace s21
+
+#endif // ISLAND_MODEL_HPP
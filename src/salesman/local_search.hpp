@@ -0,0 +1,198 @@
+#ifndef LOCAL_SEARCH_HPP
+#define LOCAL_SEARCH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../graph/s21_graph.h"
+
+namespace s21 {
+
+#define LOCAL_SEARCH_NEIGHBOURS 8
+#define OR_OPT_SEGMENT 3
+
+enum LocalSearchMode {
+    NoLocalSearch,
+    BestTour,
+    EveryTour
+};
+
+// 2-opt and Or-opt over the nearest neighbours of every vertex with don't-look
+// bits. Zero distance means no edge, moves never introduce one. 2-opt reverses
+// part of the tour, so it only runs on symmetric distances.
+class LocalSearch {
+public:
+    explicit LocalSearch(const s21::Graph& distance, size_t neighbours = LOCAL_SEARCH_NEIGHBOURS)
+        : distance_(distance)
+        , size_(distance.MatrixSize())
+        , symmetric_(true)
+        , neighbours_(size_)
+    {
+        for(size_t i = 0; i < size_; ++i) {
+            for(size_t z = 0; z < size_; ++z) {
+                if(distance_(i, z) != distance_(z, i)) symmetric_ = false;
+                if(i != z && distance_(i, z) != 0) neighbours_[i].push_back(z);
+            }
+            auto nearest = [&](size_t a, size_t b) { return distance_(i, a) < distance_(i, b); };
+            size_t count = std::min(neighbours, neighbours_[i].size());
+            std::partial_sort(neighbours_[i].begin(), neighbours_[i].begin() + count, neighbours_[i].end(), nearest);
+            neighbours_[i].resize(count);
+        }
+    }
+
+    ~LocalSearch() = default;
+
+    // Improves a closed tour in place, returns false when road is not a complete tour.
+    bool Improve(std::vector<size_t>& road) {
+        if(size_ < 4 || road.size() != size_ + 1 || road.front() != road.back()) return false;
+        tour_.assign(road.begin(), road.end() - 1);
+        position_.assign(size_, size_);
+        for(size_t i = 0; i < size_; ++i) {
+            if(tour_[i] >= size_ || position_[tour_[i]] != size_) return false;
+            position_[tour_[i]] = i;
+        }
+
+        active_.assign(size_, true);
+        queue_ = tour_;
+        while(!queue_.empty()) {
+            size_t vertex = queue_.back();
+            queue_.pop_back();
+            active_[vertex] = false;
+            if(!symmetric_ || !TwoOpt(vertex)) OrOpt(vertex);
+        }
+
+        road.assign(tour_.begin(), tour_.end());
+        road.push_back(tour_.front());
+        return true;
+    }
+
+private:
+    static constexpr int64_t NO_EDGE = INT64_C(1) << 40;
+
+    const s21::Graph& distance_;
+    size_t size_;
+    bool symmetric_;
+    std::vector<std::vector<size_t>> neighbours_;
+    std::vector<size_t> tour_;
+    std::vector<size_t> position_;
+    std::vector<bool> active_;
+    std::vector<size_t> queue_;
+
+    inline int64_t Cost(size_t from, size_t to) const {
+        int weight = distance_(from, to);
+        return weight == 0 && from != to ? NO_EDGE : weight;
+    }
+
+    inline size_t Next(size_t vertex) const { return tour_[(position_[vertex] + 1) % size_]; }
+
+    inline size_t Prev(size_t vertex) const { return tour_[(position_[vertex] + size_ - 1) % size_]; }
+
+    void Wake(size_t vertex) {
+        if(active_[vertex]) return;
+        active_[vertex] = true;
+        queue_.push_back(vertex);
+    }
+
+    // Reverses the tour from position i to position z, going forward and wrapping.
+    void Reverse(size_t i, size_t z) {
+        size_t length = (z + size_ - i) % size_ + 1;
+        if(length * 2 > size_) {
+            std::swap(i, z);
+            i = (i + 1) % size_;
+            z = (z + size_ - 1) % size_;
+            length = size_ - length;
+        }
+        for(size_t k = 0; k < length / 2; ++k) {
+            size_t a = (i + k) % size_, b = (z + size_ - k) % size_;
+            std::swap(tour_[a], tour_[b]);
+            position_[tour_[a]] = a;
+            position_[tour_[b]] = b;
+        }
+    }
+
+    // Replaces a-succ(a) and c-succ(c) by a-c and succ(a)-succ(c), then the same
+    // with predecessors.
+    bool TwoOpt(size_t a) {
+        for(int direction = 0; direction < 2; ++direction) {
+            size_t b = direction == 0 ? Next(a) : Prev(a);
+            int64_t removed = Cost(a, b);
+            for(auto c : neighbours_[a]) {
+                int64_t added = Cost(a, c);
+                if(added >= removed) break;
+                size_t d = direction == 0 ? Next(c) : Prev(c);
+                if(c == b || d == a) continue;
+                if(added + Cost(b, d) < removed + Cost(c, d)) {
+                    if(direction == 0) {
+                        Reverse(position_[b], position_[c]);
+                    } else {
+                        Reverse(position_[c], position_[b]);
+                    }
+                    Wake(a);
+                    Wake(b);
+                    Wake(c);
+                    Wake(d);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Moves a segment of up to OR_OPT_SEGMENT vertices starting at first between a
+    // neighbour of first and the vertex after it, reversed if that is cheaper.
+    bool OrOpt(size_t first) {
+        size_t last = first;
+        for(size_t length = 1; length <= OR_OPT_SEGMENT && length + 2 < size_; ++length) {
+            if(length > 1) last = Next(last);
+            size_t prev = Prev(first), next = Next(last);
+            int64_t gain = Cost(prev, first) + Cost(last, next) - Cost(prev, next);
+            if(gain <= 0) continue;
+            for(auto c : neighbours_[first]) {
+                if(InSegment(c, first, length) || c == prev) continue;
+                size_t d = Next(c);
+                int64_t base = Cost(c, d);
+                if(Cost(c, first) + Cost(last, d) - base < gain) {
+                    MoveSegment(first, length, c, false);
+                } else if(symmetric_ && Cost(c, last) + Cost(first, d) - base < gain) {
+                    MoveSegment(first, length, c, true);
+                } else {
+                    continue;
+                }
+                Wake(prev);
+                Wake(next);
+                Wake(c);
+                Wake(d);
+                Wake(first);
+                Wake(last);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline bool InSegment(size_t vertex, size_t first, size_t length) const {
+        return (position_[vertex] + size_ - position_[first]) % size_ < length;
+    }
+
+    // Cuts the segment out and inserts it right after vertex after.
+    void MoveSegment(size_t first, size_t length, size_t after, bool reversed) {
+        std::vector<size_t> segment(length), rest;
+        rest.reserve(size_ - length);
+        size_t start = position_[first];
+        for(size_t k = 0; k < length; ++k) segment[k] = tour_[(start + k) % size_];
+        if(reversed) std::reverse(segment.begin(), segment.end());
+        for(size_t k = length; k < size_; ++k) {
+            size_t vertex = tour_[(start + k) % size_];
+            rest.push_back(vertex);
+            if(vertex == after) rest.insert(rest.end(), segment.begin(), segment.end());
+        }
+        tour_.swap(rest);
+        for(size_t i = 0; i < size_; ++i) position_[tour_[i]] = i;
+    }
+
+}; // LocalSearch
+
+}; // namespace s21
+
+#endif // LOCAL_SEARCH_HPP
@@ -1,37 +1,152 @@
 #ifndef PATH_HPP
 #define PATH_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "../data/matrix.hpp"
 #include "../graph/s21_graph.h"
 
 namespace s21 {
 
+#define CANDIDATE_LIST_SIZE 15
+
+// Reads the distances straight from the graph, which has to outlive the path.
+// Pheromones, heuristic and choice values are floats in a single row, the full
+// matrix or, when every edge weighs the same both ways, only its upper
+// triangle, so (i, z) and (z, i) share one trail.
 class Path {
 public:
-    Path(s21::Graph graph)
-        : graph_(graph.Matrix())
-        , pheromones_(graph.MatrixSize(), graph.MatrixSize())
+    // Ants choose among the candidates nearest vertices first, zero disables the lists.
+    Path(const s21::Graph& graph, size_t candidates = CANDIDATE_LIST_SIZE)
+        : graph_(graph)
+        , size_(graph.MatrixSize())
+        , symmetric_(Symmetric(graph))
+        , pheromones_(1, Cells())
+        , candidates_(candidates == 0 ? 0 : size_)
+        , candidate_choice_(candidates_.size())
+        , heuristic_(1, Cells())
+        , choice_(1, Cells())
+        , heuristic_alpha_(NAN)
+        , choice_beta_(NAN)
+        , choice_stale_(true)
         , VAPORATION_COEF(0.75)
     {
-        for(size_t i = 0; i < pheromones_.Rows(); ++i) {
-            for(size_t z = 0; z < pheromones_.Cols(); ++z) {
-                if(i != z) pheromones_(i, z) = 0.2f;
-                if(i == z) pheromones_(i, z) = 0.0f;
+        ResetPheromones(0.2);
+        for(size_t i = 0; i < candidates_.size(); ++i) {
+            for(size_t z = 0; z < size_; ++z) {
+                if(i != z && graph_(i, z) != 0) candidates_[i].push_back(z);
             }
+            auto nearest = [&](size_t a, size_t b) { return graph_(i, a) < graph_(i, b); };
+            size_t count = std::min(candidates, candidates_[i].size());
+            std::partial_sort(candidates_[i].begin(), candidates_[i].begin() + count, candidates_[i].end(), nearest);
+            candidates_[i].resize(count);
+            candidate_choice_[i].resize(count);
         }
     }
 
     ~Path() = default;
 
-    s21::Matrix<int>& Distance() { return graph_; }
+    inline const s21::Graph& Distance() const noexcept { return graph_; }
+
+    inline bool IsSymmetric() const noexcept { return symmetric_; }
 
-    s21::Matrix<double>& Pheromones() { return pheromones_; }
+    inline float Pheromone(size_t i, size_t z) const { return pheromones_(0, Cell(i, z)); }
+
+    inline size_t MemoryUsage() const noexcept {
+        size_t cells = pheromones_.Size() + heuristic_.Size() + choice_.Size();
+        for(auto& it : candidate_choice_) cells += it.size();
+        return cells * sizeof(float);
+    }
+
+    // Distance^-alpha * pheromone^beta of every move as float, scaled so that the
+    // largest entry is 1. A common factor leaves the ratios an ant compares alone
+    // and keeps them in float range. Zero for missing edges and loops, recomputed
+    // after the trails change.
+    void PrepareChoice(double alpha, double beta) {
+        if(alpha != heuristic_alpha_) {
+            heuristic_alpha_ = alpha;
+            choice_stale_ = true;
+            for(size_t i = 0; i < size_; ++i) {
+                for(size_t z = symmetric_ ? i : 0; z < size_; ++z) {
+                    double value = i != z && graph_(i, z) != 0 ? std::pow(graph_(i, z), -alpha) : 0.0;
+                    heuristic_(0, Cell(i, z)) = std::isfinite(value) && value > 0 ? static_cast<float>(value) : 0.0f;
+                }
+            }
+        }
+        if(!choice_stale_ && beta == choice_beta_) return;
+        choice_beta_ = beta;
+        choice_stale_ = false;
+        auto value = [&](size_t cell) {
+            double pheromone = beta == 1.0 ? pheromones_(0, cell) : std::pow(pheromones_(0, cell), beta);
+            double res = heuristic_(0, cell) * pheromone;
+            return std::isfinite(res) && res > 0 ? res : 0.0;
+        };
+        double max = 0;
+        for(size_t i = 0; i < choice_.Size(); ++i) max = std::max(max, value(i));
+        for(size_t i = 0; i < choice_.Size(); ++i) choice_(0, i) = max > 0 ? static_cast<float>(value(i) / max) : 0.0f;
+        for(size_t i = 0; i < candidates_.size(); ++i) {
+            for(size_t z = 0; z < candidates_[i].size(); ++z) candidate_choice_[i][z] = Choice(i, candidates_[i][z]);
+        }
+    }
+
+    // Choice value of a move, valid after PrepareChoice.
+    inline float Choice(size_t i, size_t z) const { return choice_(0, Cell(i, z)); }
+
+    // Choice values of every move from vertex, indexed by target. Points into the
+    // matrix in the full layout. The triangle keeps the moves to lower vertices
+    // in a column, so they are gathered into buffer together with the rest.
+    const float* ChoiceRow(size_t vertex, float* buffer) const {
+        const float* cells = &choice_(0, 0);
+        if(!symmetric_) return cells + vertex * size_;
+        for(size_t z = 0; z < vertex; ++z) buffer[z] = cells[Cell(z, vertex)];
+        std::copy(cells + Cell(vertex, vertex), cells + Cell(vertex, size_ - 1) + 1, buffer + vertex);
+        return buffer;
+    }
+
+    inline bool HasCandidates() const noexcept { return !candidates_.empty(); }
+
+    // Nearest neighbours of the vertex by increasing distance.
+    inline const std::vector<size_t>& Candidates(size_t vertex) const { return candidates_[vertex]; }
+
+    // Choice values of the candidates of vertex in the same order, contiguous so
+    // an ant step reads them without a gather. Valid after PrepareChoice.
+    inline const float* CandidateChoice(size_t vertex) const { return candidate_choice_[vertex].data(); }
 
     void UpdatePheromones(std::vector<size_t>& path) {
         SpreadPheromones(path);
         PheromoneEvaporation();
     }
 
+    // Single evaporation step, keep is the retained share.
+    void EvaporatePheromones(double keep) {
+        choice_stale_ = true;
+        float* cells = Data(pheromones_);
+        float factor = static_cast<float>(keep);
+        for(size_t i = 0; i < pheromones_.Size(); ++i) cells[i] *= factor;
+    }
+
+    void DepositPheromones(std::vector<size_t>& path, double amount) {
+        choice_stale_ = true;
+        for(size_t i = 0; i + 1 < path.size(); ++i) pheromones_(0, Cell(path[i], path[i + 1])) += amount;
+    }
+
+    void ClampPheromones(double min, double max) {
+        choice_stale_ = true;
+        float* cells = Data(pheromones_);
+        float low = static_cast<float>(min), high = static_cast<float>(max);
+        for(size_t i = 0; i < pheromones_.Size(); ++i) cells[i] = std::min(high, std::max(low, cells[i]));
+        ClearLoops();
+    }
+
+    void ResetPheromones(double value) {
+        choice_stale_ = true;
+        float* cells = Data(pheromones_);
+        std::fill(cells, cells + pheromones_.Size(), static_cast<float>(value));
+        ClearLoops();
+    }
+
     size_t CalculatePathLength(std::vector<size_t>& path) {
         size_t res = 0;
         for(size_t i = 0; i < path.size() - 1; ++i) {
@@ -41,20 +156,54 @@ public:
     }
 
 private:
-    s21::Matrix<int> graph_;
-    s21::Matrix<double> pheromones_;
+    const s21::Graph& graph_;
+    size_t size_;
+    bool symmetric_;
+    s21::Matrix<float> pheromones_;
+    std::vector<std::vector<size_t>> candidates_;
+    std::vector<std::vector<float>> candidate_choice_;
+    s21::Matrix<float> heuristic_;
+    s21::Matrix<float> choice_;
+    double heuristic_alpha_;
+    double choice_beta_;
+    bool choice_stale_;
     const double VAPORATION_COEF;
 
+    static bool Symmetric(const s21::Graph& graph) {
+        if(graph.IsSymmetric()) return true;
+        for(size_t i = 0; i < graph.MatrixSize(); ++i) {
+            for(size_t z = i + 1; z < graph.MatrixSize(); ++z) {
+                if(graph(i, z) != graph(z, i)) return false;
+            }
+        }
+        return true;
+    }
+
+    inline size_t Cells() const noexcept { return symmetric_ ? size_ * (size_ + 1) / 2 : size_ * size_; }
+
+    static inline float* Data(s21::Matrix<float>& matrix) { return matrix.Size() == 0 ? nullptr : &matrix(0, 0); }
+
+    inline size_t Cell(size_t i, size_t z) const noexcept {
+        if(!symmetric_) return i * size_ + z;
+        if(i > z) std::swap(i, z);
+        return i * size_ - i * (i + 1) / 2 + z;
+    }
+
+    void ClearLoops() {
+        for(size_t i = 0; i < size_; ++i) pheromones_(0, Cell(i, i)) = 0.0f;
+    }
+
     void SpreadPheromones(std::vector<size_t>& path) {
+        choice_stale_ = true;
         size_t path_length = CalculatePathLength(path);
-        double coef = static_cast<double>(graph_.Rows()) / static_cast<double>(path_length);
+        double coef = static_cast<double>(size_) / static_cast<double>(path_length);
         for(size_t i = 0; i < path.size() - 1; ++i) {
-            pheromones_(path[i], path[i + 1]) += coef;
+            pheromones_(0, Cell(path[i], path[i + 1])) += coef;
         }
     }
 
     void PheromoneEvaporation() {
-        for(size_t i = 0; i < pheromones_.Size(); ++i) pheromones_[i] *= VAPORATION_COEF;
+        EvaporatePheromones(VAPORATION_COEF);
     }
 
 
@@ -62,4 +211,4 @@ private:
 
 }; // namespace s21
 
-#endif // PATH_HPP
\ No newline at end of file
+#endif // PATH_HPP
@@ -0,0 +1,323 @@
+#ifndef TOUR_CONSTRUCTION_HPP
+#define TOUR_CONSTRUCTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../graph/s21_graph.h"
+#include "tsmresult.hpp"
+
+namespace s21 {
+
+#define CONSTRUCTION_STARTS 16
+#define SPACE_FILLING_CURVE_ORDER 16
+
+enum ConstructionMethod {
+    NearestNeighbour,
+    GreedyEdge,
+    Christofides,
+    AllConstructions
+};
+
+// Fast heuristic tours in O(V^2) to O(V^2 log V). Every tour is closed and starts
+// at vertex 0, an empty tour with infinite distance means the heuristic could not
+// close a tour over the existing edges.
+class TourConstruction {
+public:
+    TourConstruction() = delete;
+
+    static TsmResult Build(const Graph& graph, ConstructionMethod method = AllConstructions) {
+        if(method == NearestNeighbour) return NearestNeighbourTour(graph);
+        if(method == GreedyEdge) return GreedyEdgeTour(graph);
+        if(method == Christofides) return ChristofidesTour(graph);
+        TsmResult res = NearestNeighbourTour(graph);
+        for(auto& it : {GreedyEdgeTour(graph), ChristofidesTour(graph)}) {
+            if(it.distance < res.distance) res = it;
+        }
+        return res;
+    }
+
+    // Always moves to the nearest unvisited vertex, the shortest tour of up to
+    // starts evenly spread start vertices.
+    static TsmResult NearestNeighbourTour(const Graph& graph, size_t starts = CONSTRUCTION_STARTS) {
+        size_t size = graph.MatrixSize();
+        TsmResult res = Failed();
+        starts = std::max<size_t>(1, std::min(starts, size));
+        std::vector<bool> visited(size);
+        for(size_t s = 0; s < starts; ++s) {
+            size_t start = s * size / starts;
+            std::fill(visited.begin(), visited.end(), false);
+            std::vector<size_t> road = {start};
+            visited[start] = true;
+            while(road.size() < size) {
+                size_t next = size;
+                for(size_t i = 0; i < size; ++i) {
+                    int weight = graph(road.back(), i);
+                    if(!visited[i] && weight > 0 && (next == size || weight < graph(road.back(), next))) next = i;
+                }
+                if(next == size) break;
+                visited[next] = true;
+                road.push_back(next);
+            }
+            TsmResult tour = Close(graph, road);
+            if(tour.distance < res.distance) res = tour;
+        }
+        return res;
+    }
+
+    // Takes the edges by increasing weight while they keep every vertex on a
+    // simple path, then chains the paths by their nearest ends.
+    static TsmResult GreedyEdgeTour(const Graph& graph) {
+        size_t size = graph.MatrixSize();
+        bool symmetric = Symmetric(graph);
+        std::vector<std::pair<size_t, size_t>> edges;
+        for(size_t i = 0; i < size; ++i) {
+            for(size_t z = symmetric ? i + 1 : 0; z < size; ++z) {
+                if(i != z && graph(i, z) > 0) edges.emplace_back(i, z);
+            }
+        }
+        std::sort(edges.begin(), edges.end(), [&](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) {
+            return graph(a.first, a.second) < graph(b.first, b.second);
+        });
+
+        // Symmetric links are undirected, next and prev then both hold neighbours.
+        std::vector<size_t> next(size, size), prev(size, size), parent(size);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find = [&](size_t vertex) {
+            while(parent[vertex] != vertex) vertex = parent[vertex] = parent[parent[vertex]];
+            return vertex;
+        };
+        size_t added = 0;
+        for(auto& it : edges) {
+            if(added + 1 >= size) break;
+            size_t from = it.first, to = it.second;
+            bool free = symmetric ? (prev[from] == size || next[from] == size) && (prev[to] == size || next[to] == size)
+                                  : next[from] == size && prev[to] == size;
+            if(!free || find(from) == find(to)) continue;
+            parent[find(from)] = find(to);
+            if(symmetric) {
+                (next[from] == size ? next[from] : prev[from]) = to;
+                (next[to] == size ? next[to] : prev[to]) = from;
+            } else {
+                next[from] = to;
+                prev[to] = from;
+            }
+            ++added;
+        }
+
+        std::vector<std::vector<size_t>> fragments;
+        std::vector<bool> visited(size, false);
+        for(size_t i = 0; i < size; ++i) {
+            bool end = symmetric ? prev[i] == size || next[i] == size : prev[i] == size;
+            if(visited[i] || !end) continue;
+            fragments.emplace_back();
+            for(size_t vertex = i, before = size; vertex != size;) {
+                visited[vertex] = true;
+                fragments.back().push_back(vertex);
+                size_t after = next[vertex] != before ? next[vertex] : prev[vertex];
+                if(!symmetric) after = next[vertex];
+                before = vertex;
+                vertex = after == size || visited[after] ? size : after;
+            }
+        }
+        return Close(graph, Chain(graph, fragments, symmetric));
+    }
+
+    // Spanning tree plus a greedy matching of its odd vertices, the Euler circuit
+    // of both shortcut to a tour. Within 1.5 of the optimum only with an exact
+    // matching, so this is a heuristic for symmetric metric graphs.
+    static TsmResult ChristofidesTour(const Graph& graph) {
+        size_t size = graph.MatrixSize();
+        if(size < 3 || !Symmetric(graph)) return size < 3 ? NearestNeighbourTour(graph) : Failed();
+
+        std::vector<std::vector<size_t>> adjacency(size);
+        std::vector<int64_t> key(size, INT64_MAX);
+        std::vector<size_t> from(size, size);
+        std::vector<bool> taken(size, false);
+        key[0] = 0;
+        for(size_t step = 0; step < size; ++step) {
+            size_t next = size;
+            for(size_t i = 0; i < size; ++i) {
+                if(!taken[i] && (next == size || key[i] < key[next])) next = i;
+            }
+            if(key[next] == INT64_MAX) return Failed();
+            taken[next] = true;
+            if(from[next] != size) {
+                adjacency[next].push_back(from[next]);
+                adjacency[from[next]].push_back(next);
+            }
+            for(size_t i = 0; i < size; ++i) {
+                int weight = graph(next, i);
+                if(!taken[i] && weight > 0 && weight < key[i]) {
+                    key[i] = weight;
+                    from[i] = next;
+                }
+            }
+        }
+
+        std::vector<size_t> odd;
+        for(size_t i = 0; i < size; ++i) {
+            if(adjacency[i].size() % 2 == 1) odd.push_back(i);
+        }
+        std::vector<std::pair<size_t, size_t>> pairs;
+        for(size_t i = 0; i < odd.size(); ++i) {
+            for(size_t z = i + 1; z < odd.size(); ++z) {
+                if(graph(odd[i], odd[z]) > 0) pairs.emplace_back(odd[i], odd[z]);
+            }
+        }
+        std::sort(pairs.begin(), pairs.end(), [&](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) {
+            return graph(a.first, a.second) < graph(b.first, b.second);
+        });
+        std::vector<bool> matched(size, false);
+        size_t matches = 0;
+        for(auto& it : pairs) {
+            if(matched[it.first] || matched[it.second]) continue;
+            matched[it.first] = matched[it.second] = true;
+            adjacency[it.first].push_back(it.second);
+            adjacency[it.second].push_back(it.first);
+            ++matches;
+        }
+        if(matches * 2 != odd.size()) return Failed();
+
+        // Hierholzer over the multigraph, each edge is used once from either end.
+        std::vector<size_t> used(size, 0), stack = {0}, road;
+        std::vector<bool> visited(size, false);
+        std::vector<std::vector<bool>> gone(size);
+        for(size_t i = 0; i < size; ++i) gone[i].assign(adjacency[i].size(), false);
+        while(!stack.empty()) {
+            size_t vertex = stack.back();
+            while(used[vertex] < adjacency[vertex].size() && gone[vertex][used[vertex]]) ++used[vertex];
+            if(used[vertex] == adjacency[vertex].size()) {
+                stack.pop_back();
+                if(!visited[vertex]) road.push_back(vertex);
+                visited[vertex] = true;
+                continue;
+            }
+            size_t to = adjacency[vertex][used[vertex]];
+            gone[vertex][used[vertex]] = true;
+            for(size_t k = 0; k < adjacency[to].size(); ++k) {
+                if(adjacency[to][k] == vertex && !gone[to][k]) {
+                    gone[to][k] = true;
+                    break;
+                }
+            }
+            stack.push_back(to);
+        }
+        return Close(graph, road);
+    }
+
+    // Visits the points in the order of a Hilbert curve over their bounding box,
+    // points[i] is the position of vertex i.
+    static TsmResult SpaceFillingCurveTour(const Graph& graph, const std::vector<std::pair<double, double>>& points) {
+        size_t size = graph.MatrixSize();
+        if(points.size() != size) return Failed();
+        double min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+        for(auto& it : points) {
+            min_x = std::min(min_x, it.first);
+            max_x = std::max(max_x, it.first);
+            min_y = std::min(min_y, it.second);
+            max_y = std::max(max_y, it.second);
+        }
+        double side = std::max(max_x - min_x, max_y - min_y);
+        uint64_t cells = uint64_t(1) << SPACE_FILLING_CURVE_ORDER;
+        std::vector<std::pair<uint64_t, size_t>> order(size);
+        for(size_t i = 0; i < size; ++i) {
+            double x = side > 0 ? (points[i].first - min_x) / side : 0, y = side > 0 ? (points[i].second - min_y) / side : 0;
+            uint64_t cx = std::min<uint64_t>(cells - 1, static_cast<uint64_t>(x * cells));
+            uint64_t cy = std::min<uint64_t>(cells - 1, static_cast<uint64_t>(y * cells));
+            order[i] = {HilbertIndex(cx, cy, cells), i};
+        }
+        std::sort(order.begin(), order.end());
+        std::vector<size_t> road;
+        for(auto& it : order) road.push_back(it.second);
+        return Close(graph, road);
+    }
+
+private:
+    static TsmResult Failed() { return TsmResult{{}, INFINITY}; }
+
+    static bool Symmetric(const Graph& graph) {
+        if(graph.IsSymmetric()) return true;
+        for(size_t i = 0; i < graph.MatrixSize(); ++i) {
+            for(size_t z = i + 1; z < graph.MatrixSize(); ++z) {
+                if(graph(i, z) != graph(z, i)) return false;
+            }
+        }
+        return true;
+    }
+
+    // Closes an order of all vertices into a tour from vertex 0.
+    static TsmResult Close(const Graph& graph, std::vector<size_t> road) {
+        size_t size = graph.MatrixSize();
+        if(size == 0 || road.size() != size) return Failed();
+        std::rotate(road.begin(), std::find(road.begin(), road.end(), 0), road.end());
+        road.push_back(road.front());
+        std::vector<bool> seen(size, false);
+        int64_t length = 0;
+        for(size_t i = 0; i < size; ++i) {
+            if(road[i] >= size || seen[road[i]]) return Failed();
+            seen[road[i]] = true;
+            int weight = graph(road[i], road[i + 1]);
+            if(weight <= 0 && size > 1) return Failed();
+            length += weight;
+        }
+        return TsmResult{road, static_cast<double>(length)};
+    }
+
+    // Appends the fragment whose nearer end is closest to the tail, reversed when
+    // that end is its last vertex.
+    static std::vector<size_t> Chain(const Graph& graph, std::vector<std::vector<size_t>>& fragments, bool symmetric) {
+        std::vector<size_t> road;
+        std::vector<bool> joined(fragments.size(), false);
+        for(size_t step = 0; step < fragments.size(); ++step) {
+            size_t best = fragments.size();
+            bool reversed = false;
+            int best_weight = 0;
+            for(size_t f = 0; f < fragments.size(); ++f) {
+                if(joined[f]) continue;
+                if(road.empty()) {
+                    best = f;
+                    break;
+                }
+                for(int end = 0; end < (symmetric ? 2 : 1); ++end) {
+                    int weight = graph(road.back(), end == 0 ? fragments[f].front() : fragments[f].back());
+                    if(weight > 0 && (best == fragments.size() || weight < best_weight)) {
+                        best = f;
+                        best_weight = weight;
+                        reversed = end == 1;
+                    }
+                }
+            }
+            if(best == fragments.size()) return {};
+            joined[best] = true;
+            if(reversed) std::reverse(fragments[best].begin(), fragments[best].end());
+            road.insert(road.end(), fragments[best].begin(), fragments[best].end());
+        }
+        return road;
+    }
+
+    static uint64_t HilbertIndex(uint64_t x, uint64_t y, uint64_t cells) {
+        uint64_t res = 0;
+        for(uint64_t s = cells / 2; s > 0; s /= 2) {
+            uint64_t rx = (x & s) > 0, ry = (y & s) > 0;
+            res += s * s * ((3 * rx) ^ ry);
+            if(ry == 0) {
+                if(rx == 1) {
+                    x = cells - 1 - x;
+                    y = cells - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return res;
+    }
+
+}; // TourConstruction
+
+}; // namespace s21
+
+#endif // TOUR_CONSTRUCTION_HPP
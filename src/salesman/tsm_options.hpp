@@ -0,0 +1,29 @@
+#ifndef TSM_OPTIONS_HPP
+#define TSM_OPTIONS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+#include "tsmresult.hpp"
+
+namespace s21 {
+
+#define TSM_STAGNATION_LIMIT 30
+
+// Limits of an anytime salesman run, zero deadline and iterations mean no limit.
+// The run stops at whichever limit comes first and returns the best tour so far.
+struct TsmOptions {
+    std::chrono::milliseconds deadline{0};
+    size_t max_iterations = 0;
+    // Iterations in a row without a shorter tour.
+    size_t stagnation = TSM_STAGNATION_LIMIT;
+    // Set by the caller from any thread to stop the run.
+    const std::atomic<bool>* cancel = nullptr;
+    // Receives every tour shorter than all previous ones.
+    std::function<void(const TsmResult&)> on_improvement;
+};
+
+};
+
+#endif // TSM_OPTIONS_HPP
@@ -11,6 +11,14 @@ struct TsmResult {
     double distance;
 };
 
+struct TsmBoundedResult {
+    TsmResult tour;
+    // No tour is shorter than the lower bound.
+    double lower_bound;
+    // Relative distance between the tour and the bound, zero for a proven optimum.
+    double gap;
+};
+
 };
 
 #endif // TSMRESULT_HPP
\ No newline at end of file
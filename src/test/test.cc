@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
 #include "../algorithms/s21_graph_algorithms.h"
+#include "../routing/dynamic_all_pairs.hpp"
+#include "../routing/path_cache.hpp"
+#include "../routing/tiled_all_pairs.hpp"
+#include "../data/mapped_allocator.hpp"
+#include "../algorithms/reordered_algorithms.hpp"
+#include "../graph/vertex_order.hpp"
 
 TEST(BFS, test1) {
   s21::Graph a;
@@ -54,6 +60,56 @@ TEST(BetweenTwoVert, test2) {
   EXPECT_EQ(res, 17);
 }
 
+TEST(BetweenTwoVert, test3) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  a.RemoveEdge(2, 7);
+  a.AddVertex();
+  for (int i = 1; i <= 12; ++i) {
+    for (int z = 1; z <= 12; ++z) {
+      EXPECT_EQ(b.GetShortestPathBetweenVertices(a, i, z, s21::Bidirectional),
+                b.GetShortestPathBetweenVertices(a, i, z));
+    }
+  }
+}
+
+TEST(ShortestPathTree, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  a.RemoveEdge(2, 7);
+  a.AddVertex();
+  for (int i = 1; i <= 12; ++i) {
+    s21::ShortestPathTree check = b.GetShortestPathTree(a, i);
+    s21::ShortestPathTree res = b.GetShortestPathTreeParallel(a, i, 4);
+    EXPECT_EQ(res.distance, check.distance);
+    for (size_t z = 0; z < res.parent.size(); ++z) {
+      if (res.parent[z] != -1) {
+        EXPECT_EQ(res.distance[z],
+                  res.distance[res.parent[z]] + a(res.parent[z], z));
+      }
+    }
+  }
+}
+
+TEST(ShortestPathTree, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  for (int i = 0; i < 400; ++i) a.AddVertex();
+  for (int i = 2; i <= 300; ++i) a.SetEdge(1, i, 1);
+  for (int i = 2; i <= 400; ++i) {
+    for (int k = 1; k <= 4; ++k) a.SetEdge(i, 2 + (i * 37 + k * 101) % 399, k);
+  }
+  for (int i : {1, 2, 350}) {
+    s21::ShortestPathTree check = b.GetShortestPathTree(a, i);
+    EXPECT_EQ(b.GetShortestPathTreeParallel(a, i, 4).distance, check.distance);
+    EXPECT_EQ(b.GetShortestPathTreeParallel(a, i, 3).distance, check.distance);
+  }
+}
+
 TEST(BetweenAllVert, test1) {
   s21::Graph a;
   s21::GraphAlgorithms b;
@@ -64,6 +120,99 @@ TEST(BetweenAllVert, test1) {
   for (size_t i = 0; i < check.size(); ++i) EXPECT_EQ(check[i], res(0, i));
 }
 
+TEST(BetweenAllVert, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  a.RemoveEdge(2, 7);
+  a.SetEdge(3, 3, 5);
+  a.AddVertex();
+  s21::Matrix<int> floyd =
+      b.GetShortestPathsBetweenAllVertices(a, s21::FloydWarshall);
+  s21::Matrix<int> johnson =
+      b.GetShortestPathsBetweenAllVertices(a, s21::Johnson);
+  EXPECT_TRUE(floyd == johnson);
+  EXPECT_EQ(johnson(2, 2), 0);
+  EXPECT_EQ(johnson(11, 0), -1);
+
+  a.LoadGraphFromFile("test/test2.txt");
+  EXPECT_TRUE(b.GetShortestPathsBetweenAllVertices(a, s21::Johnson) ==
+              b.GetShortestPathsBetweenAllVertices(a));
+}
+
+TEST(BetweenAllVert, test3) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  a.RemoveEdge(2, 7);
+  a.AddVertex();
+  for (auto method : {s21::FloydWarshall, s21::Johnson}) {
+    s21::NextHopMatrix next_hop;
+    s21::Matrix<int> res =
+        b.GetShortestPathsBetweenAllVertices(a, next_hop, method);
+    EXPECT_EQ(next_hop.Width(), 1);
+    for (int i = 1; i <= 12; ++i) {
+      for (int z = 1; z <= 12; ++z) {
+        std::vector<int> route = next_hop.Route(i, z);
+        if (res(i - 1, z - 1) == -1) {
+          EXPECT_TRUE(route.empty());
+          continue;
+        }
+        int length = 0;
+        for (size_t x = 0; x + 1 < route.size(); ++x)
+          length += a(route[x] - 1, route[x + 1] - 1);
+        EXPECT_EQ(route.front(), i);
+        EXPECT_EQ(route.back(), z);
+        EXPECT_EQ(length, res(i - 1, z - 1));
+      }
+    }
+  }
+  s21::NextHopMatrix wide;
+  wide.Resize(300);
+  wide.Set(299, 1, 298);
+  EXPECT_EQ(wide.Width(), 2);
+  EXPECT_EQ(wide.Get(299, 1), 298);
+  EXPECT_EQ(wide.Get(1, 299), s21::NextHopMatrix::NONE);
+}
+
+TEST(DistanceTable, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  a.RemoveEdge(2, 7);
+  a.AddVertex();
+  std::vector<int> sources = {1, 7, 12, 3, 7}, targets = {2, 7, 12, 9, 40};
+  s21::Matrix<int> res = b.GetDistanceTable(a, sources, targets);
+  EXPECT_EQ(res.Rows(), sources.size());
+  EXPECT_EQ(res.Cols(), targets.size());
+  for (size_t i = 0; i < sources.size(); ++i) {
+    for (size_t z = 0; z < targets.size() - 1; ++z) {
+      int check = b.GetShortestPathBetweenVertices(a, sources[i], targets[z]);
+      if (check == 0 && sources[i] != targets[z]) check = -1;
+      EXPECT_EQ(res(i, z), check);
+    }
+    EXPECT_EQ(res(i, targets.size() - 1), -1);
+  }
+}
+
+TEST(SpanningTree, test2) {
+  s21::Graph a, c;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test2.txt");
+  c.LoadGraphFromFile("test/test2.txt");
+  for (int i = 1; i <= 7; ++i) {
+    for (int z = 1; z <= 7; ++z) c.SetEdge(i, z, a(i - 1, z - 1) * 5000);
+  }
+  s21::Matrix<int> res = b.GetLeastSpanningTree(a);
+  s21::Matrix<int> check = b.GetLeastSpanningTree(c);
+  res *= 5000;
+  EXPECT_TRUE(res == check);
+  EXPECT_EQ(b.GetShortestPathBetweenVertices(c, 1, 4), 17 * 5000);
+}
+
 TEST(SpanningTree, test1) {
   s21::Graph a;
   s21::GraphAlgorithms b;
@@ -84,6 +233,1067 @@ TEST(TSM, test1) {
   EXPECT_TRUE(res.distance < 300.0);
 }
 
+TEST(TSM, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  const int size = HELD_KARP_THRESHOLD + 10;
+  std::vector<double> x, y;
+  for (int i = 0; i < size; ++i) {
+    double angle = 2.0 * M_PI * ((i * 7) % size) / size;
+    x.push_back(1000.0 * std::cos(angle));
+    y.push_back(1000.0 * std::sin(angle));
+    a.AddVertex();
+  }
+  for (int i = 0; i < size; ++i) {
+    for (int z = 0; z < size; ++z) {
+      if (i != z)
+        a.SetEdge(i + 1, z + 1, 1 + std::hypot(x[i] - x[z], y[i] - y[z]));
+    }
+  }
+  // Going round the circle is optimal up to the rounding of the weights.
+  int ring = 0;
+  for (int i = 0; i < size; ++i) {
+    ring += a((i * 13) % size, (i * 13 + 13) % size);
+  }
+  s21::TsmResult res = b.SolveTravelingSalesmanProblem(a);
+  ASSERT_EQ(res.vertices.size(), size + 1);
+  EXPECT_EQ(res.vertices.front(), res.vertices.back());
+  std::vector<size_t> order(res.vertices.begin(), res.vertices.end() - 1);
+  std::sort(order.begin(), order.end());
+  for (int i = 0; i < size; ++i) EXPECT_EQ(order[i], i);
+  int length = 0;
+  for (int i = 0; i < size; ++i) {
+    length += a(res.vertices[i], res.vertices[i + 1]);
+  }
+  EXPECT_DOUBLE_EQ(res.distance, length);
+  EXPECT_LE(res.distance, ring * 1.02);
+}
+
+TEST(PriorityQueues, test1) {
+  s21::RadixHeap<int> radix;
+  s21::BucketQueue<int> buckets(10);
+  s21::BinaryHeap<int> heap;
+  std::vector<size_t> keys = {7, 3, 3, 9, 12, 5, 4};
+  for (size_t i = 0; i < keys.size(); ++i) {
+    radix.Push(keys[i], i);
+    buckets.Push(keys[i], i);
+    heap.Push(keys[i], i);
+  }
+  std::sort(keys.begin(), keys.end());
+  for (auto it : keys) {
+    EXPECT_EQ(radix.Pop().first, it);
+    EXPECT_EQ(buckets.Pop().first, it);
+    EXPECT_EQ(heap.Pop().first, it);
+  }
+  EXPECT_TRUE(radix.Empty() && buckets.Empty() && heap.Empty());
+  EXPECT_THROW(radix.Push(2, 0), std::invalid_argument);
+  EXPECT_THROW(buckets.Pop(), std::out_of_range);
+}
+
+TEST(SearchWorkspace, test1) {
+  s21::Graph a, c;
+  s21::GraphAlgorithms b;
+  s21::SearchWorkspace workspace;
+  a.LoadGraphFromFile("test/test1.txt");
+  c.LoadGraphFromFile("test/test2.txt");
+  for (int round = 0; round < 2; ++round) {
+    for (s21::Graph *it : {&a, &c}) {
+      int size = it->MatrixSize();
+      for (int i = 1; i <= size; ++i) {
+        EXPECT_EQ(b.DepthFirstSearch(*it, i, workspace),
+                  b.DepthFirstSearch(*it, i));
+        EXPECT_EQ(b.BreadthFirstSearch(*it, i, workspace),
+                  b.BreadthFirstSearch(*it, i));
+        for (int z = 1; z <= size; ++z) {
+          EXPECT_EQ(
+              b.GetShortestPathBetweenVertices(*it, i, z, workspace),
+              b.GetShortestPathBetweenVertices(*it, i, z, s21::Bidirectional));
+        }
+      }
+      EXPECT_TRUE(b.GetLeastSpanningTree(*it, workspace) ==
+                  b.GetLeastSpanningTree(*it));
+    }
+  }
+}
+
+TEST(PathCache, test1) {
+  s21::Graph a;
+  s21::ShortestPathCache cache;
+  a.LoadGraphFromFile("test/test2.txt");
+  EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 17);
+  EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 2), 41);
+  EXPECT_EQ(cache.Hits(), 1);
+  EXPECT_EQ(cache.Misses(), 1);
+
+  s21::ShortestPathCache::MatrixPtr all =
+      cache.GetShortestPathsBetweenAllVertices(a);
+  EXPECT_EQ((*all)(0, 3), 17);
+  EXPECT_EQ(cache.GetShortestPathsBetweenAllVertices(a), all);
+}
+
+TEST(PathCache, test2) {
+  s21::Graph a;
+  s21::ShortestPathCache cache;
+  a.LoadGraphFromFile("test/test2.txt");
+  EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 17);
+  a.Edit()(0, 5) = 1;
+  EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 6);
+  EXPECT_EQ(cache.Misses(), 2);
+  {
+    s21::Graph::Writer writer = a.Edit();
+    writer(0, 5) = 2;
+    EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 7);
+    writer(0, 5) = 3;
+  }
+  EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 8);
+  EXPECT_EQ(cache.Misses(), 4);
+  {
+    s21::Graph::Writer writer = a.Edit();
+    writer(0, 5) = 4;
+    EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 9);
+    writer(0, 3) = 1;
+    EXPECT_EQ(cache.GetShortestPathBetweenVertices(a, 1, 4), 1);
+  }
+  EXPECT_EQ(cache.Misses(), 6);
+}
+
+TEST(EdgeUpdates, test1) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test2.txt");
+  uint64_t version = a.Version();
+  EXPECT_TRUE(a.SetEdge(1, 4, 3));
+  EXPECT_FALSE(a.SetEdge(1, 8, 3));
+  EXPECT_NE(a.Version(), version);
+  EXPECT_EQ(a(0, 3), 3);
+  EXPECT_TRUE(a.RemoveEdge(1, 4));
+  EXPECT_EQ(a(0, 3), 0);
+  EXPECT_EQ(a.AddVertex(), 8);
+  EXPECT_EQ(a.MatrixSize(), 8);
+  EXPECT_EQ(a(5, 3), 5);
+  EXPECT_EQ(a.MaxWeight(), 45);
+  {
+    s21::Graph::Writer writer = a.Edit();
+    writer(1, 5) = 3;
+    writer(5, 1) = 3;
+  }
+  EXPECT_EQ(a.MaxWeight(), 24);
+  EXPECT_TRUE(a.SetEdge(2, 6, 50));
+  EXPECT_EQ(a.MaxWeight(), 50);
+
+  s21::Graph b;
+  s21::GraphAlgorithms c;
+  for (int i = 0; i < 4; ++i) b.AddVertex();
+  s21::Graph::Writer writer = b.Edit();
+  writer(0, 1) = 2;
+  EXPECT_EQ(b.MaxWeight(), 2);
+  writer(0, 3) = 300;
+  writer(1, 2) = 2;
+  writer(2, 3) = 2;
+  EXPECT_EQ(b.MaxWeight(), 300);
+  EXPECT_EQ(c.GetShortestPathBetweenVertices(b, 1, 4), 6);
+}
+
+TEST(EdgeUpdates, test2) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::DynamicAllPairs dynamic(a);
+  std::vector<std::vector<int>> updates = {
+      {1, 5, 2}, {5, 1, 2}, {1, 5, 40}, {3, 8, 0}, {8, 3, 0}, {7, 2, 1}};
+  for (auto &it : updates) {
+    dynamic.SetEdge(a, it[0], it[1], it[2]);
+    s21::DynamicAllPairs check(a);
+    EXPECT_TRUE(dynamic.Distances() == check.Distances());
+  }
+  int vertex = dynamic.AddVertex(a);
+  dynamic.SetEdge(a, vertex, 1, 5);
+  s21::DynamicAllPairs check(a);
+  EXPECT_TRUE(dynamic.Distances() == check.Distances());
+  EXPECT_EQ(dynamic.Distance(1, vertex), -1);
+  EXPECT_EQ(dynamic.Distance(vertex, 2), 5 + check.Distance(1, 2));
+}
+
+TEST(Landmarks, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  s21::Landmarks farthest, avoid;
+  farthest.Build(a, 3, s21::Farthest);
+  avoid.Build(a, 3, s21::Avoid);
+  EXPECT_EQ(farthest.Count(), 3);
+  for (int i = 1; i <= 11; ++i) {
+    for (int z = 1; z <= 11; ++z) {
+      int check = b.GetShortestPathBetweenVertices(a, i, z);
+      EXPECT_EQ(b.GetShortestPathBetweenVertices(a, i, z, farthest), check);
+      EXPECT_EQ(b.GetShortestPathBetweenVertices(a, i, z, avoid), check);
+    }
+  }
+}
+
+TEST(Landmarks, test2) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test2.txt");
+  s21::Landmarks landmarks, loaded;
+  landmarks.Build(a, 2);
+  EXPECT_TRUE(landmarks.Save("test/test2.landmarks"));
+  EXPECT_TRUE(loaded.Load("test/test2.landmarks", a));
+  std::remove("test/test2.landmarks");
+  EXPECT_EQ(loaded.Vertices(), landmarks.Vertices());
+  size_t settled = 0;
+  EXPECT_EQ(loaded.Query(a, 1, 4, &settled), 17);
+  EXPECT_TRUE(settled > 0 && settled <= 7);
+  EXPECT_FALSE(loaded.Load("test/test1.txt", a));
+  EXPECT_EQ(loaded.Count(), 0);
+  std::string rows = "0 2 4 3 5 5 4\n0 2 4 3 5 5 4\n";
+  for (std::string id : {"1", "0", "8"}) {
+    std::ofstream("test/test2.landmarks") << "1 7\n" << id << "\n" << rows;
+    EXPECT_EQ(loaded.Load("test/test2.landmarks", a), id == "1");
+    EXPECT_EQ(loaded.Count(), id == "1" ? 1 : 0);
+  }
+  std::ofstream("test/test2.landmarks") << "2 7\n1 2\n" << rows;
+  EXPECT_FALSE(loaded.Load("test/test2.landmarks", a));
+  std::remove("test/test2.landmarks");
+  EXPECT_EQ(loaded.Count(), 0);
+  EXPECT_EQ(loaded.Query(a, 1, 4), 17);
+
+  s21::GraphAlgorithms b;
+  EXPECT_TRUE(landmarks.Matches(a));
+  a.SetEdge(1, 4, 1);
+  EXPECT_FALSE(landmarks.Matches(a));
+  EXPECT_EQ(b.GetShortestPathBetweenVertices(a, 1, 4, landmarks), 0);
+  landmarks.Build(a, 2);
+  EXPECT_EQ(b.GetShortestPathBetweenVertices(a, 1, 4, landmarks), 1);
+  a.AddVertex();
+  EXPECT_FALSE(landmarks.Matches(a));
+  EXPECT_EQ(landmarks.Query(a, 1, 8), 0);
+}
+
+TEST(ContractionHierarchy, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(7, 2, 1);
+  a.RemoveEdge(2, 7);
+  s21::ContractionHierarchy hierarchy;
+  hierarchy.Build(a, 4);
+  for (int i = 1; i <= 11; ++i) {
+    for (int z = 1; z <= 11; ++z) {
+      EXPECT_EQ(b.GetShortestPathBetweenVertices(a, i, z, hierarchy),
+                b.GetShortestPathBetweenVertices(a, i, z));
+    }
+  }
+}
+
+TEST(ContractionHierarchy, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test2.txt");
+  a.AddVertex();
+  s21::ContractionHierarchy hierarchy, loaded;
+  hierarchy.Build(a);
+  EXPECT_TRUE(hierarchy.Save("test/test2.ch"));
+  EXPECT_TRUE(loaded.Load("test/test2.ch"));
+  std::string header, ranks;
+  {
+    std::ifstream fin("test/test2.ch");
+    std::getline(fin, header);
+    std::getline(fin, ranks);
+  }
+  s21::ContractionHierarchy broken;
+  EXPECT_TRUE(broken.Load("test/test2.ch"));
+  std::ofstream("test/test2.ch") << header << "\n" << ranks.substr(0, 6);
+  EXPECT_FALSE(broken.Load("test/test2.ch"));
+  EXPECT_EQ(broken.Size(), 0);
+  std::ofstream("test/test2.ch") << header << "\n0 0 1 2 3 4 5 6\n";
+  EXPECT_FALSE(broken.Load("test/test2.ch"));
+  std::remove("test/test2.ch");
+  EXPECT_EQ(loaded.Size(), 8);
+  EXPECT_EQ(loaded.Shortcuts(), hierarchy.Shortcuts());
+  for (int i = 1; i <= 8; ++i) {
+    for (int z = 1; z <= 8; ++z) {
+      EXPECT_EQ(b.GetShortestPathBetweenVertices(a, i, z, loaded),
+                b.GetShortestPathBetweenVertices(a, i, z));
+    }
+  }
+}
+
+TEST(TiledAllPairs, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Matrix<int> check = b.GetShortestPathsBetweenAllVertices(a);
+  s21::TiledAllPairs tiled("test/test1.apsp", 3 * 16 * sizeof(int));
+  EXPECT_TRUE(tiled.Run(a));
+  EXPECT_EQ(tiled.TileSize(), 4);
+  EXPECT_TRUE(tiled.Finished());
+  std::vector<int> row;
+  for (size_t i = 0; i < 11; ++i) {
+    EXPECT_TRUE(tiled.ReadRow(i, row));
+    for (size_t z = 0; z < 11; ++z) EXPECT_EQ(row[z], check(i, z));
+  }
+  EXPECT_FALSE(tiled.ReadRow(11, row));
+  std::remove("test/test1.apsp");
+}
+
+TEST(TiledAllPairs, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Matrix<int> check = b.GetShortestPathsBetweenAllVertices(a);
+  size_t calls = 0;
+  {
+    s21::TiledAllPairs tiled("test/test1.apsp", 3 * 9 * sizeof(int));
+    EXPECT_FALSE(tiled.Run(a, [&](size_t done, size_t total) {
+      ++calls;
+      EXPECT_EQ(total, 4);
+      return done < 2;
+    }));
+    EXPECT_FALSE(tiled.Finished());
+  }
+  s21::TiledAllPairs resumed("test/test1.apsp", 3 * 9 * sizeof(int));
+  EXPECT_TRUE(resumed.Run(a, [&](size_t done, size_t) {
+    ++calls;
+    return done > 2;
+  }));
+  EXPECT_EQ(calls, 4);
+  for (size_t i = 0; i < 11; ++i) {
+    for (size_t z = 0; z < 11; ++z) {
+      EXPECT_EQ(resumed.Distance(i, z), check(i, z));
+    }
+  }
+  std::remove("test/test1.apsp");
+  s21::Matrix<int, s21::MappedAllocator<int>> mapped(64, 64);
+  mapped(63, 63) = 5;
+  mapped.Reserve(128 * 128);
+  EXPECT_EQ(mapped(63, 63), 5);
+  EXPECT_EQ(mapped(0, 0), 0);
+}
+
+TEST(GraphLayout, test1) {
+  s21::Graph full, packed;
+  s21::GraphAlgorithms b;
+  full.LoadGraphFromFile("test/test1.txt");
+  EXPECT_TRUE(packed.LoadGraphFromFile("test/test1.txt", s21::Detect));
+  EXPECT_TRUE(packed.IsSymmetric());
+  EXPECT_EQ(packed.MemoryUsage(), 66 * sizeof(int));
+  EXPECT_EQ(packed.MaxWeight(), full.MaxWeight());
+  s21::Matrix<int> check = b.GetShortestPathsBetweenAllVertices(full);
+  s21::Matrix<int> res = b.GetShortestPathsBetweenAllVertices(packed);
+  for (size_t i = 0; i < 11; ++i) {
+    for (size_t z = 0; z < 11; ++z) EXPECT_EQ(res(i, z), check(i, z));
+  }
+  EXPECT_EQ(b.GetLeastSpanningTree(packed).Size(),
+            b.GetLeastSpanningTree(full).Size());
+  EXPECT_EQ(b.BreadthFirstSearch(packed, 1), b.BreadthFirstSearch(full, 1));
+  s21::DynamicAllPairs dynamic(packed);
+  dynamic.SetEdge(packed, 1, 2, 100);
+  EXPECT_EQ(packed(1, 0), 100);
+  EXPECT_EQ(packed.AddVertex(), 12);
+  EXPECT_TRUE(packed.SetEdge(12, 3, 7));
+  EXPECT_EQ(packed(2, 11), 7);
+  s21::Graph copy(packed);
+  s21::Matrix<int> square = copy.FullMatrix();
+  for (size_t i = 0; i < 11; ++i) {
+    EXPECT_EQ(dynamic.Distance(2, i + 1),
+              b.GetShortestPathBetweenVertices(packed, 2, i + 1));
+    for (size_t z = 0; z < 11; ++z) EXPECT_EQ(square(i, z), packed(z, i));
+  }
+}
+
+TEST(GraphLayout, test2) {
+  s21::BasicGraph<uint8_t> narrow;
+  s21::BasicGraph<float> real;
+  EXPECT_TRUE(narrow.LoadGraphFromFile("test/test2.txt", s21::Detect));
+  EXPECT_TRUE(narrow.IsSymmetric());
+  EXPECT_EQ(narrow.MemoryUsage(), 28);
+  EXPECT_EQ(narrow(2, 0), 2);
+  std::ofstream("test/directed.txt") << "2\n0 3\n0 0\n";
+  EXPECT_FALSE(narrow.LoadGraphFromFile("test/directed.txt", s21::Symmetric));
+  EXPECT_EQ(narrow.MatrixSize(), 0);
+  EXPECT_EQ(narrow.MemoryUsage(), 0);
+  EXPECT_TRUE(narrow.LoadGraphFromFile("test/directed.txt", s21::Detect));
+  std::remove("test/directed.txt");
+  EXPECT_FALSE(narrow.IsSymmetric());
+  EXPECT_EQ(narrow.MemoryUsage(), 4);
+  EXPECT_TRUE(real.LoadGraphFromFile("test/test1.txt", s21::Symmetric));
+  EXPECT_FLOAT_EQ(real(10, 1), 12.0f);
+  EXPECT_TRUE(real.SetEdge(1, 2, 0.5f));
+  EXPECT_FLOAT_EQ(real(1, 0), 0.5f);
+  EXPECT_FALSE(real.SetEdge(1, 2, -1.0f));
+}
+
+TEST(GraphLayout, test3) {
+  s21::BasicGraph<uint8_t> narrow;
+  s21::BasicGraph<float> real;
+  const char* rejected[] = {"2\n0 -1\n1 0\n", "2\n0 2.5\n1 0\n",
+                            "2\n0 300\n1 0\n", "2\n0 x\n1 0\n"};
+  for (const char* text : rejected) {
+    std::ofstream("test/range.txt") << text;
+    EXPECT_FALSE(narrow.LoadGraphFromFile("test/range.txt"));
+    EXPECT_EQ(narrow.MatrixSize(), 0);
+  }
+  std::ofstream("test/range.txt") << "2\n0 255\n2.5 0\n";
+  EXPECT_FALSE(narrow.LoadGraphFromFile("test/range.txt"));
+  EXPECT_TRUE(real.LoadGraphFromFile("test/range.txt"));
+  EXPECT_FLOAT_EQ(real(1, 0), 2.5f);
+  std::ofstream("test/range.txt") << "2\n0 255\n255 0\n";
+  EXPECT_TRUE(narrow.LoadGraphFromFile("test/range.txt"));
+  EXPECT_EQ(narrow.MaxWeight(), 255);
+  std::remove("test/range.txt");
+}
+
+TEST(GraphLayout, test4) {
+  s21::Graph full;
+  s21::BasicGraph<uint8_t> narrow;
+  s21::BasicGraph<uint16_t> packed;
+  s21::GraphAlgorithms b;
+  full.LoadGraphFromFile("test/test1.txt");
+  EXPECT_TRUE(narrow.LoadGraphFromFile("test/test1.txt"));
+  EXPECT_TRUE(packed.LoadGraphFromFile("test/test1.txt", s21::Symmetric));
+  s21::Matrix<int> check = b.GetShortestPathsBetweenAllVertices(full);
+  for (auto method : {s21::FloydWarshall, s21::Johnson}) {
+    EXPECT_TRUE(b.GetShortestPathsBetweenAllVertices(narrow, method) == check);
+    EXPECT_TRUE(b.GetShortestPathsBetweenAllVertices(packed, method) == check);
+  }
+  EXPECT_TRUE(b.GetLeastSpanningTree(narrow) == b.GetLeastSpanningTree(full));
+  EXPECT_TRUE(b.GetLeastSpanningTree(packed) == b.GetLeastSpanningTree(full));
+  EXPECT_EQ(b.DepthFirstSearch(narrow, 3), b.DepthFirstSearch(full, 3));
+  EXPECT_EQ(b.GetStronglyConnectedComponents(packed),
+            b.GetStronglyConnectedComponents(full));
+  for (int i = 1; i <= 11; ++i) {
+    EXPECT_EQ(b.GetShortestPathBetweenVertices(narrow, 1, i),
+              check(0, i - 1));
+    EXPECT_EQ(
+        b.GetShortestPathBetweenVertices(packed, i, 1, s21::Bidirectional),
+        check(i - 1, 0));
+  }
+}
+
+TEST(VertexOrder, test1) {
+  s21::Graph a;
+  for (int i = 0; i < 8; ++i) a.AddVertex();
+  std::vector<int> chain = {1, 5, 8, 2, 7, 3, 6, 4};
+  for (size_t i = 0; i + 1 < chain.size(); ++i) {
+    a.SetEdge(chain[i], chain[i + 1], static_cast<int>(i) + 1);
+    a.SetEdge(chain[i + 1], chain[i], static_cast<int>(i) + 1);
+  }
+  s21::Graph check(a);
+  EXPECT_EQ(s21::VertexOrder::Bandwidth(a), 6);
+  s21::VertexOrder order;
+  EXPECT_TRUE(order.Reorder(a));
+  EXPECT_EQ(s21::VertexOrder::Bandwidth(a), 1);
+  for (int i = 1; i <= 8; ++i) {
+    EXPECT_EQ(order.Current(order.Original(i)), i);
+  }
+  EXPECT_EQ(order.Original(9), 0);
+  EXPECT_TRUE(order.Reorder(a, s21::BreadthFirst));
+  EXPECT_EQ(s21::VertexOrder::Bandwidth(a), 1);
+  EXPECT_TRUE(order.Reorder(a, s21::DegreeSorted));
+  EXPECT_TRUE(order.Undo(a));
+  EXPECT_TRUE(order.Empty());
+  for (int i = 0; i < 8; ++i) {
+    for (int z = 0; z < 8; ++z) EXPECT_EQ(a(i, z), check(i, z));
+  }
+}
+
+TEST(VertexOrder, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test2.txt", s21::Detect);
+  s21::Matrix<int> distance = b.GetShortestPathsBetweenAllVertices(a);
+  std::vector<int> traversal = b.BreadthFirstSearch(a, 3);
+  s21::VertexOrder order;
+  EXPECT_TRUE(order.Reorder(a));
+  EXPECT_TRUE(a.IsSymmetric());
+  s21::Matrix<int> res =
+      order.Restore(b.GetShortestPathsBetweenAllVertices(a));
+  for (size_t i = 0; i < 7; ++i) {
+    for (size_t z = 0; z < 7; ++z) EXPECT_EQ(res(i, z), distance(i, z));
+  }
+  std::vector<int> visited =
+      order.Restore(b.BreadthFirstSearch(a, order.Current(3)));
+  EXPECT_EQ(visited.front(), 3);
+  std::sort(visited.begin(), visited.end());
+  std::sort(traversal.begin(), traversal.end());
+  EXPECT_EQ(visited, traversal);
+  EXPECT_EQ(b.GetShortestPathBetweenVertices(a, order.Current(1),
+                                             order.Current(4)),
+            17);
+}
+
+TEST(VertexOrder, test3) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test2.txt");
+  a.RemoveEdge(1, 7);
+  s21::Graph check(a);
+  s21::VertexOrder order;
+  s21::ReorderedAlgorithms reordered(order);
+  EXPECT_EQ(reordered.BreadthFirstSearch(a, 2), b.BreadthFirstSearch(check, 2));
+  EXPECT_TRUE(order.Reorder(a, s21::DegreeSorted));
+  EXPECT_NE(order.Current(1), 1);
+  EXPECT_EQ(reordered.DepthFirstSearch(a, 2).front(), 2);
+  EXPECT_EQ(reordered.BreadthFirstSearch(a, 6).front(), 6);
+  EXPECT_EQ(reordered.GetShortestPathBetweenVertices(a, 1, 4), 17);
+  EXPECT_TRUE(reordered.GetShortestPathsBetweenAllVertices(a) ==
+              b.GetShortestPathsBetweenAllVertices(check));
+  std::vector<int> sources = {1, 7}, targets = {4, 2, 9};
+  EXPECT_TRUE(reordered.GetDistanceTable(a, sources, targets) ==
+              b.GetDistanceTable(check, sources, targets));
+  s21::ShortestPathTree tree = reordered.GetShortestPathTree(a, 7);
+  s21::ShortestPathTree direct = b.GetShortestPathTree(check, 7);
+  EXPECT_EQ(tree.source, 6);
+  EXPECT_EQ(tree.distance, direct.distance);
+  EXPECT_EQ(tree.parent[0], 6);
+  EXPECT_EQ(reordered.GetStronglyConnectedComponents(a),
+            b.GetStronglyConnectedComponents(check));
+  EXPECT_EQ(reordered.GetConnectedComponents(a),
+            b.GetConnectedComponents(check));
+  s21::Graph c;
+  c.LoadGraphFromFile("test/test1.txt");
+  s21::Graph original(c);
+  s21::VertexOrder bandwidth;
+  s21::ReorderedAlgorithms symmetric(bandwidth);
+  EXPECT_TRUE(bandwidth.Reorder(c));
+  s21::Matrix<int> tree_edges = symmetric.GetLeastSpanningTree(c);
+  s21::Matrix<int> direct_edges = b.GetLeastSpanningTree(original);
+  int weight = 0, direct_weight = 0;
+  for (size_t i = 0; i < 11; ++i) {
+    for (size_t z = 0; z < 11; ++z) {
+      if (tree_edges(i, z) != 0) {
+        EXPECT_EQ(tree_edges(i, z), original(i, z));
+      }
+      weight += tree_edges(i, z);
+      direct_weight += direct_edges(i, z);
+    }
+  }
+  EXPECT_EQ(weight, direct_weight);
+  s21::TsmResult tour = symmetric.SolveTravelingSalesmanProblem(c);
+  EXPECT_DOUBLE_EQ(tour.distance, 253.0);
+  double length = 0;
+  for (size_t i = 0; i + 1 < tour.vertices.size(); ++i) {
+    length += original(tour.vertices[i], tour.vertices[i + 1]);
+  }
+  EXPECT_DOUBLE_EQ(length, tour.distance);
+}
+
+TEST(Components, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  for (int i = 0; i < 7; ++i) a.AddVertex();
+  a.SetEdge(1, 2, 1);
+  a.SetEdge(2, 3, 1);
+  a.SetEdge(3, 1, 1);
+  a.SetEdge(3, 4, 1);
+  a.SetEdge(5, 6, 1);
+  a.SetEdge(6, 5, 1);
+  std::vector<int> weak = {0, 0, 0, 0, 1, 1, 2};
+  std::vector<int> strong = {0, 0, 0, 1, 2, 2, 3};
+  EXPECT_EQ(b.GetConnectedComponents(a), weak);
+  EXPECT_EQ(b.GetConnectedComponents(a, 3), weak);
+  EXPECT_EQ(b.GetStronglyConnectedComponents(a), strong);
+  EXPECT_EQ(b.GetStronglyConnectedComponents(a, s21::ForwardBackward),
+            strong);
+  EXPECT_FALSE(b.IsConnected(a));
+  EXPECT_THROW(b.GetLeastSpanningTree(a), std::logic_error);
+  EXPECT_THROW(b.SolveTravelingSalesmanProblem(a), std::logic_error);
+}
+
+TEST(Components, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  EXPECT_TRUE(b.IsConnected(a));
+  EXPECT_TRUE(b.IsStronglyConnected(a));
+  a.LoadGraphFromFile("test/test2.txt");
+  EXPECT_TRUE(b.IsConnected(a));
+  for (int i = 2; i <= 7; ++i) a.RemoveEdge(1, i);
+  EXPECT_TRUE(b.IsConnected(a));
+  EXPECT_FALSE(b.IsStronglyConnected(a));
+  EXPECT_EQ(b.GetStronglyConnectedComponents(a, s21::ForwardBackward),
+            b.GetStronglyConnectedComponents(a));
+  EXPECT_THROW(b.GetLeastSpanningTree(a), std::logic_error);
+  a.LoadGraphFromFile("test/test2.txt");
+  for (int i = 2; i <= 7; ++i) a.RemoveEdge(i, 1);
+  EXPECT_NO_THROW(b.GetLeastSpanningTree(a));
+}
+
+TEST(LocalSearch, test1) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Path path(a);
+  s21::LocalSearch search(path.Distance());
+  std::vector<size_t> road = {0, 5, 1, 7, 2, 9, 3, 10, 4, 8, 6, 0};
+  size_t length = path.CalculatePathLength(road);
+  EXPECT_TRUE(search.Improve(road));
+  EXPECT_LT(path.CalculatePathLength(road), length);
+  EXPECT_EQ(road.size(), 12);
+  EXPECT_EQ(road.front(), road.back());
+  std::vector<size_t> sorted(road.begin(), road.end() - 1);
+  std::sort(sorted.begin(), sorted.end());
+  for (size_t i = 0; i < sorted.size(); ++i) EXPECT_EQ(sorted[i], i);
+  std::vector<size_t> open = {0, 1, 2};
+  EXPECT_FALSE(search.Improve(open));
+}
+
+TEST(LocalSearch, test2) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::AntColony colony(a, s21::EveryTour);
+  colony.CreateAnts(11);
+  colony.ReleaseAnts();
+  s21::TsmResult res = colony.GetBestPath();
+  EXPECT_EQ(res.vertices.size(), 12);
+  EXPECT_LT(res.distance, 300.0);
+}
+
+TEST(HeldKarp, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::TsmResult res = b.SolveTravelingSalesmanProblemHeldKarp(a);
+  EXPECT_DOUBLE_EQ(res.distance, 253.0);
+  EXPECT_EQ(res.vertices.size(), 12);
+  EXPECT_EQ(res.vertices.front(), 0);
+  EXPECT_EQ(res.vertices.back(), 0);
+  double length = 0;
+  for (size_t i = 0; i + 1 < res.vertices.size(); ++i) {
+    length += a(res.vertices[i], res.vertices[i + 1]);
+  }
+  EXPECT_DOUBLE_EQ(length, res.distance);
+  EXPECT_DOUBLE_EQ(b.SolveTravelingSalesmanProblem(a).distance, 253.0);
+  EXPECT_DOUBLE_EQ(s21::HeldKarp(4).Solve(a).distance, 253.0);
+  while (a.MatrixSize() <= HELD_KARP_MAX_VERTICES) a.AddVertex();
+  EXPECT_TRUE(s21::HeldKarp().Solve(a).vertices.empty());
+  EXPECT_THROW(b.SolveTravelingSalesmanProblemHeldKarp(a), std::logic_error);
+}
+
+TEST(HeldKarp, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  for (int i = 0; i < 4; ++i) a.AddVertex();
+  a.SetEdge(1, 2, 1);
+  a.SetEdge(2, 1, 1);
+  a.SetEdge(2, 3, 1);
+  a.SetEdge(3, 2, 1);
+  a.SetEdge(2, 4, 1);
+  a.SetEdge(4, 2, 1);
+  EXPECT_TRUE(b.IsStronglyConnected(a));
+  EXPECT_THROW(b.SolveTravelingSalesmanProblemHeldKarp(a), std::logic_error);
+  a.SetEdge(1, 3, 5);
+  a.SetEdge(4, 1, 2);
+  a.SetEdge(3, 4, 3);
+  s21::TsmResult res = b.SolveTravelingSalesmanProblem(a);
+  std::vector<size_t> check = {0, 1, 2, 3, 0};
+  EXPECT_EQ(res.vertices, check);
+  EXPECT_DOUBLE_EQ(res.distance, 7.0);
+}
+
+TEST(BranchAndBound, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::TsmBoundedResult res =
+      b.SolveTravelingSalesmanProblemBranchAndBound(a, 10000, 2);
+  EXPECT_DOUBLE_EQ(res.tour.distance, 253.0);
+  EXPECT_DOUBLE_EQ(res.lower_bound, 253.0);
+  EXPECT_DOUBLE_EQ(res.gap, 0.0);
+  EXPECT_EQ(res.tour.vertices.size(), 12);
+  EXPECT_EQ(res.tour.vertices.front(), 0);
+  s21::TsmBoundedResult rushed =
+      s21::BranchAndBound(1).Solve(a, std::chrono::milliseconds(0));
+  EXPECT_FALSE(rushed.tour.vertices.empty());
+  EXPECT_LE(rushed.lower_bound, 253.0);
+  EXPECT_GE(rushed.tour.distance, 253.0);
+  EXPECT_GE(rushed.gap, 0.0);
+}
+
+TEST(BranchAndBound, test2) {
+  s21::Graph a;
+  for (int i = 0; i < 4; ++i) a.AddVertex();
+  a.SetEdge(1, 2, 1);
+  a.SetEdge(2, 3, 1);
+  a.SetEdge(3, 4, 3);
+  a.SetEdge(4, 1, 2);
+  a.SetEdge(2, 1, 1);
+  a.SetEdge(1, 3, 5);
+  s21::TsmBoundedResult res =
+      s21::BranchAndBound(2).Solve(a, std::chrono::milliseconds(1000));
+  std::vector<size_t> check = {0, 1, 2, 3, 0};
+  EXPECT_EQ(res.tour.vertices, check);
+  EXPECT_DOUBLE_EQ(res.gap, 0.0);
+  a.RemoveEdge(4, 1);
+  res = s21::BranchAndBound(2).Solve(a, std::chrono::milliseconds(1000));
+  EXPECT_TRUE(res.tour.vertices.empty());
+}
+
+TEST(BranchAndBound, test3) {
+  s21::Graph a;
+  const int size = 16;
+  for (int i = 0; i < size; ++i) a.AddVertex();
+  for (int i = 1; i <= size; ++i) {
+    for (int z = i + 1; z <= size; ++z) {
+      int weight = 1 + (i * 131 + z * 71 + i * z * 29) % 100;
+      a.SetEdge(i, z, weight);
+      a.SetEdge(z, i, weight);
+    }
+  }
+  // A zero budget leaves only the root, whose Held-Karp bound is close to the
+  // optimum, unlike a plain spanning tree.
+  double optimum = s21::HeldKarp(1).Solve(a).distance;
+  s21::TsmBoundedResult res =
+      s21::BranchAndBound(1).Solve(a, std::chrono::milliseconds(0));
+  EXPECT_LE(res.lower_bound, optimum);
+  EXPECT_GE(res.lower_bound, 0.95 * optimum);
+  res = s21::BranchAndBound(2).Solve(a, std::chrono::milliseconds(5000));
+  EXPECT_DOUBLE_EQ(res.tour.distance, optimum);
+  EXPECT_DOUBLE_EQ(res.gap, 0.0);
+}
+
+TEST(TsmOptions, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  for (int i = 0; i < 24; ++i) a.AddVertex();
+  for (int i = 1; i <= 24; ++i) {
+    for (int z = 1; z <= 24; ++z) {
+      if (i != z) a.SetEdge(i, z, std::abs(i - z) * 3 + (i * z) % 7 + 1);
+    }
+  }
+  s21::TsmOptions options;
+  std::vector<double> improvements;
+  options.max_iterations = 3;
+  options.on_improvement = [&](const s21::TsmResult &res) {
+    improvements.push_back(res.distance);
+  };
+  s21::TsmResult res = b.SolveTravelingSalesmanProblem(a, options);
+  EXPECT_EQ(res.vertices.size(), 25);
+  EXPECT_FALSE(improvements.empty());
+  EXPECT_LE(improvements.size(), 3);
+  EXPECT_DOUBLE_EQ(improvements.back(), res.distance);
+  EXPECT_TRUE(std::is_sorted(improvements.rbegin(), improvements.rend()));
+}
+
+TEST(TsmOptions, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  for (int i = 0; i < 24; ++i) a.AddVertex();
+  for (int i = 1; i <= 24; ++i) {
+    for (int z = 1; z <= 24; ++z) {
+      if (i != z) a.SetEdge(i, z, (i * 7 + z * 13) % 50 + 1);
+    }
+  }
+  std::atomic<bool> cancel(true);
+  size_t calls = 0;
+  s21::TsmOptions options;
+  options.cancel = &cancel;
+  options.on_improvement = [&](const s21::TsmResult &) { ++calls; };
+  EXPECT_EQ(b.SolveTravelingSalesmanProblem(a, options).vertices.size(), 25);
+  EXPECT_EQ(calls, 1);
+  cancel = false;
+  options.stagnation = 1000000;
+  options.deadline = std::chrono::milliseconds(50);
+  auto start = std::chrono::steady_clock::now();
+  b.SolveTravelingSalesmanProblem(a, options);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(CandidateList, test1) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Path path(a, 3);
+  EXPECT_TRUE(path.HasCandidates());
+  std::vector<size_t> nearest = {8, 7, 4};
+  EXPECT_EQ(path.Candidates(0), nearest);
+  EXPECT_FALSE(s21::Path(a, 0).HasCandidates());
+  s21::Ant ant(0);
+  ant.Run(path);
+  std::vector<size_t> road = ant.Road();
+  EXPECT_EQ(road.size(), 12);
+  std::sort(road.begin(), road.end() - 1);
+  for (size_t i = 0; i < 11; ++i) EXPECT_EQ(road[i], i);
+}
+
+TEST(CandidateList, test2) {
+  s21::Graph a;
+  for (int i = 0; i < 60; ++i) a.AddVertex();
+  for (int i = 1; i <= 60; ++i) {
+    for (int z = 1; z <= 60; ++z) {
+      if (i != z) a.SetEdge(i, z, std::abs(i - z) + (i + z) % 3 + 1);
+    }
+  }
+  s21::AntColony colony(a, s21::NoLocalSearch, 5);
+  colony.CreateAnts(60);
+  colony.ReleaseAnts();
+  s21::TsmResult res = colony.GetBestPath();
+  EXPECT_EQ(res.vertices.size(), 61);
+  EXPECT_LT(res.distance, 400.0);
+}
+
+TEST(MaxMinAntSystem, test1) {
+  s21::Graph a;
+  for (int i = 0; i < 30; ++i) a.AddVertex();
+  for (int i = 1; i <= 30; ++i) {
+    for (int z = 1; z <= 30; ++z) {
+      if (i != z) a.SetEdge(i, z, std::abs(i - z) * 2 + (i * z) % 5 + 1);
+    }
+  }
+  s21::AntColony colony(a, s21::NoLocalSearch, CANDIDATE_LIST_SIZE,
+                        s21::MaxMin);
+  double best = INFINITY;
+  for (int i = 0; i < 10; ++i) {
+    colony.CreateAnts(30);
+    colony.ReleaseAnts();
+    best = std::min(best, colony.GetBestPath().distance);
+  }
+  EXPECT_GT(colony.MinPheromone(), 0.0);
+  EXPECT_LT(colony.MinPheromone(), colony.MaxPheromone());
+  EXPECT_DOUBLE_EQ(colony.MaxPheromone(),
+                   1.0 / ((1.0 - MMAS_EVAPORATION) * best));
+}
+
+TEST(MaxMinAntSystem, test2) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::AntColony colony(a, s21::NoLocalSearch);
+  colony.SetPheromoneUpdate(s21::MaxMin);
+  s21::Path path(a);
+  double best = INFINITY;
+  for (int i = 0; i < 40; ++i) {
+    colony.CreateAnts(11);
+    colony.ReleaseAnts();
+    best = std::min(best, colony.GetBestPath().distance);
+  }
+  EXPECT_LT(best, 300.0);
+  std::vector<size_t> road = {0, 1, 2, 0};
+  path.ResetPheromones(2.0);
+  path.EvaporatePheromones(0.5);
+  path.DepositPheromones(road, 3.0);
+  path.ClampPheromones(0.5, 3.5);
+  EXPECT_FLOAT_EQ(path.Pheromone(0, 1), 3.5f);
+  EXPECT_FLOAT_EQ(path.Pheromone(1, 0), 3.5f);
+  EXPECT_FLOAT_EQ(path.Pheromone(3, 4), 1.0f);
+  EXPECT_FLOAT_EQ(path.Pheromone(0, 0), 0.0f);
+}
+
+TEST(IslandModel, test1) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::AntColony colony(a, s21::NoLocalSearch, CANDIDATE_LIST_SIZE,
+                        s21::MaxMin);
+  EXPECT_TRUE(colony.BestResult().vertices.empty());
+  s21::TsmResult tour{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0}, 0};
+  EXPECT_TRUE(colony.Immigrate(tour));
+  EXPECT_EQ(colony.BestResult().vertices, tour.vertices);
+  EXPECT_GT(colony.MaxPheromone(), 0.0);
+  EXPECT_FALSE(colony.Immigrate(colony.BestResult()));
+  EXPECT_FALSE(colony.Immigrate(s21::TsmResult{{0, 1, 0}, 0}));
+  s21::ColonyParameters parameters;
+  parameters.alpha = 3.0;
+  parameters.evaporation = 0.9;
+  colony.SetParameters(parameters);
+  EXPECT_DOUBLE_EQ(colony.Parameters().alpha, 3.0);
+  EXPECT_DOUBLE_EQ(colony.Parameters().evaporation, 0.9);
+}
+
+TEST(IslandModel, test2) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  for (int i = 0; i < 30; ++i) a.AddVertex();
+  for (int i = 1; i <= 30; ++i) {
+    for (int z = 1; z <= 30; ++z) {
+      if (i != z) a.SetEdge(i, z, std::abs(i - z) * 2 + (i * z) % 5 + 1);
+    }
+  }
+  s21::IslandOptions islands;
+  islands.islands = 3;
+  islands.migration_interval = 2;
+  s21::TsmOptions options;
+  options.max_iterations = 3;
+  s21::IslandModel model(a, islands);
+  EXPECT_EQ(model.Islands(), 3);
+  EXPECT_DOUBLE_EQ(model.Island(1).Parameters().alpha, 3.0);
+  s21::TsmResult res = model.Run(options);
+  EXPECT_EQ(res.vertices.size(), 31);
+  for (size_t i = 0; i < model.Islands(); ++i)
+    EXPECT_LE(res.distance, model.Island(i).BestResult().distance);
+  islands.topology = s21::Complete;
+  res = b.SolveTravelingSalesmanProblemIslands(a, islands, options);
+  std::vector<size_t> road(res.vertices.begin(), res.vertices.end() - 1);
+  std::sort(road.begin(), road.end());
+  for (size_t i = 0; i < 30; ++i) EXPECT_EQ(road[i], i);
+}
+
+TEST(TourConstruction, test1) {
+  s21::Graph a;
+  s21::GraphAlgorithms b;
+  a.LoadGraphFromFile("test/test1.txt");
+  double optimum = b.SolveTravelingSalesmanProblemHeldKarp(a).distance;
+  for (auto method : {s21::NearestNeighbour, s21::GreedyEdge,
+                      s21::Christofides, s21::AllConstructions}) {
+    s21::TsmResult res = s21::TourConstruction::Build(a, method);
+    if (res.vertices.empty()) continue;
+    EXPECT_EQ(res.vertices.front(), 0);
+    EXPECT_EQ(res.vertices.back(), 0);
+    std::vector<size_t> road(res.vertices.begin(), res.vertices.end() - 1);
+    std::sort(road.begin(), road.end());
+    for (size_t i = 0; i < 11; ++i) EXPECT_EQ(road[i], i);
+    EXPECT_GE(res.distance, optimum);
+  }
+  s21::TsmResult res = b.SolveTravelingSalesmanProblemApproximate(a);
+  EXPECT_EQ(res.vertices.size(), 12);
+  s21::AntColony colony(a);
+  EXPECT_TRUE(colony.Seed(res));
+  EXPECT_DOUBLE_EQ(colony.BestResult().distance, res.distance);
+  EXPECT_FALSE(colony.Seed(res));
+}
+
+TEST(TourConstruction, test2) {
+  s21::Graph a;
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 16; ++i) {
+    a.AddVertex();
+    points.emplace_back(i % 4, i / 4);
+  }
+  for (int i = 0; i < 16; ++i) {
+    for (int z = 0; z < 16; ++z) {
+      int dx = std::abs(i % 4 - z % 4), dy = std::abs(i / 4 - z / 4);
+      if (i != z) a.SetEdge(i + 1, z + 1, dx + dy);
+    }
+  }
+  s21::TsmResult res = s21::TourConstruction::SpaceFillingCurveTour(a, points);
+  EXPECT_EQ(res.vertices.size(), 17);
+  EXPECT_DOUBLE_EQ(res.distance, 18.0);
+  res = s21::TourConstruction::GreedyEdgeTour(a);
+  EXPECT_EQ(res.vertices.size(), 17);
+  EXPECT_GE(res.distance, 16.0);
+  points.pop_back();
+  res = s21::TourConstruction::SpaceFillingCurveTour(a, points);
+  EXPECT_TRUE(res.vertices.empty());
+}
+
+TEST(AntStep, test1) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Path path(a, 0);
+  path.PrepareChoice(1.0, 1.0);
+  std::vector<float> row(11);
+  float max = 0.0f;
+  for (size_t i = 0; i < 11; ++i) {
+    const float *values = path.ChoiceRow(i, row.data());
+    EXPECT_FLOAT_EQ(values[i], 0.0f);
+    for (size_t z = 0; z < 11; ++z) EXPECT_EQ(values[z], path.Choice(z, i));
+    max = std::max(max, *std::max_element(values, values + 11));
+  }
+  EXPECT_FLOAT_EQ(max, 1.0f);
+  EXPECT_FLOAT_EQ(path.Choice(5, 9), 1.0f);
+  // Alpha 2 draws the nearest vertex 8 with probability 1/16 over the sum of
+  // all inverse squared distances from 0, about 0.74.
+  std::vector<size_t> counts(11, 0);
+  for (int i = 0; i < 300; ++i) {
+    s21::Ant ant(0, 2.0, 1.0);
+    ant.Run(path);
+    std::vector<size_t> road = ant.Road();
+    ASSERT_EQ(road.size(), 12);
+    EXPECT_EQ(road.front(), road.back());
+    ++counts[road[1]];
+    std::sort(road.begin(), road.end() - 1);
+    for (size_t z = 0; z < 11; ++z) EXPECT_EQ(road[z], z);
+  }
+  EXPECT_GT(counts[8], 180);
+  EXPECT_LT(counts[8], 260);
+}
+
+TEST(AntStep, test2) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Path path(a, 0);
+  path.PrepareChoice(1.0, 1.0);
+  float before = path.Choice(0, 1);
+  path.ResetPheromones(5.0);
+  path.PrepareChoice(1.0, 1.0);
+  EXPECT_FLOAT_EQ(path.Choice(0, 1), before);
+  std::vector<size_t> road = {0, 1};
+  path.DepositPheromones(road, 1000.0);
+  path.PrepareChoice(1.0, 1.0);
+  EXPECT_FLOAT_EQ(path.Choice(0, 1), 1.0f);
+  path.PrepareChoice(2.0, 1.0);
+  EXPECT_FLOAT_EQ(path.Choice(1, 0), 1.0f);
+  std::vector<size_t> counts(11, 0);
+  for (int i = 0; i < 200; ++i) {
+    s21::Ant ant(0, 1.0, 1.0);
+    ant.Run(path);
+    EXPECT_EQ(ant.Road().size(), 12);
+    ++counts[ant.Road()[1]];
+  }
+  EXPECT_GT(counts[1], 150);
+  EXPECT_LT(counts[1], 200);
+}
+
+TEST(AntStep, test3) {
+  std::vector<float> choice(37), mask(37, 1.0f), weights(37), blocks(3);
+  for (size_t i = 0; i < choice.size(); ++i) choice[i] = 0.5f * (i % 5);
+  mask[3] = mask[20] = mask[36] = 0.0f;
+  float total = s21::WeighMoves(choice.data(), mask.data(), choice.size(),
+                                weights.data(), blocks.data());
+  std::vector<float> sums(3, 0.0f);
+  for (size_t i = 0; i < choice.size(); ++i) {
+    EXPECT_EQ(weights[i], choice[i] * mask[i]);
+    sums[i / ANT_BLOCK] += weights[i];
+  }
+  for (size_t i = 0; i < 3; ++i) EXPECT_FLOAT_EQ(blocks[i], sums[i]);
+  EXPECT_FLOAT_EQ(total, sums[0] + sums[1] + sums[2]);
+
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Path path(a, 4);
+  path.PrepareChoice(1.0, 1.0);
+  for (size_t i = 0; i < 11; ++i) {
+    const std::vector<size_t> &candidates = path.Candidates(i);
+    for (size_t z = 0; z < candidates.size(); ++z) {
+      EXPECT_EQ(path.CandidateChoice(i)[z], path.Choice(i, candidates[z]));
+    }
+  }
+}
+
+TEST(PheromoneStorage, test1) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  s21::Path path(a, 0);
+  EXPECT_TRUE(path.IsSymmetric());
+  EXPECT_EQ(&path.Distance(), &a);
+  EXPECT_EQ(path.MemoryUsage(), 3 * 66 * sizeof(float));
+  path.PrepareChoice(1.0, 1.0);
+  float before = path.Choice(7, 3);
+  std::vector<size_t> road = {3, 7};
+  path.DepositPheromones(road, 1.0);
+  EXPECT_FLOAT_EQ(path.Pheromone(7, 3), 1.2f);
+  path.PrepareChoice(1.0, 1.0);
+  EXPECT_GT(path.Choice(7, 3), before);
+}
+
+TEST(PheromoneStorage, test2) {
+  s21::Graph a;
+  a.LoadGraphFromFile("test/test1.txt");
+  a.SetEdge(1, 2, 30);
+  s21::Path path(a);
+  EXPECT_FALSE(path.IsSymmetric());
+  size_t candidates = 0;
+  for (size_t i = 0; i < 11; ++i) candidates += path.Candidates(i).size();
+  EXPECT_EQ(path.MemoryUsage(), (3 * 121 + candidates) * sizeof(float));
+  std::vector<size_t> road = {0, 1, 0};
+  path.ResetPheromones(1.0);
+  path.DepositPheromones(road, 2.0);
+  path.EvaporatePheromones(0.5);
+  EXPECT_FLOAT_EQ(path.Pheromone(0, 1), 1.5f);
+  EXPECT_FLOAT_EQ(path.Pheromone(1, 0), 1.5f);
+  EXPECT_FLOAT_EQ(path.Pheromone(1, 2), 0.5f);
+  EXPECT_EQ(path.CalculatePathLength(road), 59);
+  s21::AntColony colony(a, s21::BestTour, CANDIDATE_LIST_SIZE, s21::MaxMin);
+  colony.CreateAnts(11);
+  colony.ReleaseAnts();
+  EXPECT_EQ(colony.BestResult().vertices.size(), 12);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
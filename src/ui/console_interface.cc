@@ -127,7 +127,7 @@ void ConsoleInterface::LoadGraph() {
   std::string path;
   std::cout << "\nEnter the path to the file from the current directory: ";
   std::cin >> path;
-  if (graph_.LoadGraphFromFile(path)) {
+  if (graph_.LoadGraphFromFile(path, s21::Detect)) {
     graph_status_ = "Graph successfully loaded.";
     is_graph_loaded_ = true;
   } else {
@@ -238,15 +238,19 @@ void ConsoleInterface::SpanningTree() {
   if (is_graph_loaded_) {
     std::cout << "\nSpanning tree, matrix representation. ";
 
-    s21::Matrix<int> res = graph_handler_.GetLeastSpanningTree(graph_);
+    try {
+      s21::Matrix<int> res = graph_handler_.GetLeastSpanningTree(graph_);
 
-    std::cout << "\n";
-    for (size_t i = 0; i < res.Rows(); ++i) {
-      for (size_t z = 0; z < res.Cols(); ++z) {
-        z == res.Cols() - 1 ? std::cout << res(i, z)
-                            : std::cout << res(i, z) << " ";
-      }
       std::cout << "\n";
+      for (size_t i = 0; i < res.Rows(); ++i) {
+        for (size_t z = 0; z < res.Cols(); ++z) {
+          z == res.Cols() - 1 ? std::cout << res(i, z)
+                              : std::cout << res(i, z) << " ";
+        }
+        std::cout << "\n";
+      }
+    } catch (const std::logic_error &e) {
+      std::cout << "\n" << e.what();
     }
 
   } else {
@@ -261,12 +265,17 @@ void ConsoleInterface::Salesman() {
   if (is_graph_loaded_) {
     std::cout << "\nSolving the traveling salesman problem. ";
 
-    s21::TsmResult res = graph_handler_.SolveTravelingSalesmanProblem(graph_);
+    try {
+      s21::TsmResult res =
+          graph_handler_.SolveTravelingSalesmanProblem(graph_);
 
-    std::cout << "\nRoute length: " << res.distance << "\n";
-    for (size_t i = 0; i < res.vertices.size(); ++i) {
-      i == res.vertices.size() - 1 ? std::cout << res.vertices[i]
-                                   : std::cout << res.vertices[i] << "->";
+      std::cout << "\nRoute length: " << res.distance << "\n";
+      for (size_t i = 0; i < res.vertices.size(); ++i) {
+        i == res.vertices.size() - 1 ? std::cout << res.vertices[i]
+                                     : std::cout << res.vertices[i] << "->";
+      }
+    } catch (const std::logic_error &e) {
+      std::cout << "\n" << e.what();
     }
 
   } else {